@@ -0,0 +1,74 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <unordered_set>
+#include <vector>
+
+#include "../sources/pyincpp.hpp"
+
+// Number of pairs of keys in the same bucket, about n * (n - 1) / 2 / buckets for a uniform hash.
+template <typename T>
+inline double collision_pairs(const std::unordered_set<T>& set)
+{
+    double pairs = 0;
+    for (std::size_t i = 0; i < set.bucket_count(); ++i)
+    {
+        double size = set.bucket_size(i);
+        pairs += size * (size - 1) / 2;
+    }
+    return pairs;
+}
+
+template <typename T>
+inline void hash_quality(const char* name, const std::vector<T>& keys)
+{
+    std::unordered_set<T> set(keys.begin(), keys.end());
+    double n = set.size();
+    double expected = n * (n - 1) / 2 / set.bucket_count();
+    REQUIRE(collision_pairs(set) < expected * 1.5);
+
+    BENCHMARK(std::string("insert ") + name)
+    {
+        return std::unordered_set<T>(keys.begin(), keys.end());
+    };
+    BENCHMARK(std::string("find ") + name)
+    {
+        int count = 0;
+        for (const auto& key : keys)
+        {
+            count += set.count(key);
+        }
+        return count;
+    };
+}
+
+TEST_CASE("Hash quality", "[hash]")
+{
+    using namespace pyincpp;
+
+    std::vector<Int> sequential, multiples, powers, randoms;
+    for (int i = 0; i < 10000; ++i)
+    {
+        sequential.push_back(i);
+        multiples.push_back(Int::pow(10, 9) * i + i); // chunks [i, i]
+        powers.push_back(Int::pow(3, i % 1000) * (i / 1000 + 1));
+        randoms.push_back(Int::random(50));
+    }
+    hash_quality("sequential Int", sequential);
+    hash_quality("multiples Int", multiples);
+    hash_quality("powers Int", powers);
+    hash_quality("random Int", randoms);
+
+    std::vector<Str> strings;
+    std::vector<Fraction> fractions;
+    std::vector<Complex> complexes;
+    for (int i = 0; i < 10000; ++i)
+    {
+        strings.push_back(std::to_string(i));
+        fractions.push_back(Fraction(i % 100, i / 100 + 1));
+        complexes.push_back(Complex(i % 100, i / 100));
+    }
+    hash_quality("Str", strings);
+    hash_quality("Fraction", fractions);
+    hash_quality("Complex", complexes);
+}
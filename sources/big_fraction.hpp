@@ -0,0 +1,606 @@
+//! @file big_fraction.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief BigFraction class.
+//! @date 2026.10.17
+
+#ifndef BIG_FRACTION_HPP
+#define BIG_FRACTION_HPP
+
+#include "detail.hpp"
+
+#include "fraction.hpp"
+#include "int.hpp"
+
+namespace pyincpp
+{
+
+/// BigFraction provides support for rational number arithmetic of arbitrary size.
+/// While the numerator and denominator fit in int, they are kept in machine words and computed without allocation,
+/// and they move to Int as soon as a result doesn't fit, so the arithmetic never overflows.
+class BigFraction
+{
+private:
+    // Numerator and denominator in machine words, used if `is_small_`.
+    // Both are in [-INT_MAX, INT_MAX], so a sum of two products can't overflow long long.
+    long long small_num_ = 0;
+    long long small_den_ = 1;
+
+    // Numerator and denominator, used if not `is_small_`.
+    Int num_;
+    Int den_;
+
+    // Whether the value is kept in machine words, true if and only if the reduced numerator and denominator fit in int.
+    bool is_small_;
+
+    // Determine whether a number fits in the machine words of the small form.
+    static bool fits(long long number)
+    {
+        return number >= -INT_MAX && number <= INT_MAX;
+    }
+
+    // Determine whether an integer fits in the machine words of the small form.
+    static bool fits(const Int& number)
+    {
+        return number.digits() <= 10 && fits(number.to_number<long long>());
+    }
+
+    // Set the value to `num/den` and simplify, require |num|, |den| < 2^63.
+    void set(long long num, long long den)
+    {
+        detail::check_zero(den);
+
+        if (den < 0)
+        {
+            num = -num;
+            den = -den;
+        }
+        long long gcd = std::gcd(num, den);
+        set_simplified(num / gcd, den / gcd);
+    }
+
+    // Set the value to `num/den` and simplify.
+    void set(Int num, Int den)
+    {
+        detail::check_zero(den);
+
+        if (den.is_negative())
+        {
+            num = -num;
+            den = -den;
+        }
+        Int gcd = Int::gcd(num, den);
+        set_simplified(num / gcd, den / gcd);
+    }
+
+    // Set the value to simplified `num/den`, den > 0.
+    void set_simplified(long long num, long long den)
+    {
+        if (fits(num) && fits(den))
+        {
+            is_small_ = true;
+            small_num_ = num;
+            small_den_ = den;
+        }
+        else
+        {
+            set_simplified(Int(num), Int(den));
+        }
+    }
+
+    // Set the value to simplified `num/den`, den > 0.
+    void set_simplified(Int num, Int den)
+    {
+        if (fits(num) && fits(den))
+        {
+            set_simplified(num.to_number<long long>(), den.to_number<long long>());
+            num_ = 0;
+            den_ = 0;
+        }
+        else
+        {
+            is_small_ = false;
+            num_ = std::move(num);
+            den_ = std::move(den);
+        }
+    }
+
+    // Greatest common divisor of machine words.
+    static long long gcd_of(long long a, long long b)
+    {
+        return std::gcd(a, b);
+    }
+
+    // Greatest common divisor of integers.
+    static Int gcd_of(const Int& a, const Int& b)
+    {
+        return Int::gcd(a, b);
+    }
+
+    // Return a/b + c/d simplified, require simplified a/b and c/d with b, d > 0.
+    // With g = gcd(b, d), only g can share factors with a*(d/g) + c*(b/g), so gcd runs on small values (Henrici).
+    // In machine words, a, b, c, d are in int range, so nothing overflows long long.
+    template <typename T>
+    static std::pair<T, T> add(const T& a, const T& b, const T& c, const T& d)
+    {
+        const T g = gcd_of(b, d);
+        T t = a * (d / g) + c * (b / g);
+        if (t == 0)
+        {
+            return {T(0), T(1)};
+        }
+
+        const T g2 = gcd_of(t, g);
+        return {t / g2, b / g * (d / g2)};
+    }
+
+    // Return a/b * c/d simplified, require simplified a/b and c/d with b, d > 0.
+    // Cancelling across first leaves products that are already simplified.
+    template <typename T>
+    static std::pair<T, T> mul(const T& a, const T& b, const T& c, const T& d)
+    {
+        const T g1 = gcd_of(a, d);
+        const T g2 = gcd_of(c, b);
+        return {(a / g1) * (c / g2), (b / g2) * (d / g1)};
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create a fraction with value `numerator/denominator`.
+    BigFraction(long long numerator = 0, long long denominator = 1)
+    {
+        if (fits(numerator) && fits(denominator))
+        {
+            set(numerator, denominator);
+        }
+        else
+        {
+            set(Int(numerator), Int(denominator));
+        }
+    }
+
+    /// Create a fraction with value `numerator/denominator`.
+    BigFraction(const Int& numerator, const Int& denominator = 1)
+    {
+        set(numerator, denominator);
+    }
+
+    /// Create a fraction with the value of a Fraction.
+    explicit BigFraction(const Fraction& fraction)
+        : BigFraction(fraction.numerator(), fraction.denominator())
+    {
+    }
+
+    /// Create a fraction with the exact value of a floating-point `number` as a double,
+    /// so `BigFraction(0.1)` is 3602879701896397/36028797018963968.
+    /// If `number` is NaN or infinity, throw a `runtime_error`.
+    template <std::floating_point F>
+    explicit BigFraction(F number)
+    {
+        const double x = number;
+        if (!std::isfinite(x))
+        {
+            throw std::runtime_error("Error: Cannot convert NaN or infinity to fraction.");
+        }
+
+        // x == m * 2^e exactly, |m| < 2^53, and m is odd after the trailing zeros are shifted out
+        int exp;
+        long long m = std::ldexp(std::frexp(x, &exp), 53);
+        int e = exp - 53;
+        if (m == 0)
+        {
+            set_simplified(0, 1);
+            return;
+        }
+        const int zeros = std::countr_zero((unsigned long long)m);
+        m >>= zeros;
+        e += zeros;
+
+        if (e >= 0)
+        {
+            set_simplified(Int(m) * Int::pow(2, e), Int(1));
+        }
+        else if (e > -63)
+        {
+            set_simplified(m, 1ll << -e);
+        }
+        else
+        {
+            set_simplified(Int(m), Int::pow(2, -e));
+        }
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this fraction is equal to another fraction.
+    bool operator==(const BigFraction& that) const
+    {
+        if (is_small_ != that.is_small_)
+        {
+            return false; // the form is unique for each value
+        }
+
+        return is_small_ ? small_num_ == that.small_num_ && small_den_ == that.small_den_
+                         : num_ == that.num_ && den_ == that.den_;
+    }
+
+    /// Compare the fraction with another fraction.
+    auto operator<=>(const BigFraction& that) const
+    {
+        // a/b <=> c/d is ad <=> bc since b, d > 0
+        if (is_small_ && that.is_small_)
+        {
+            const long long ad = small_num_ * that.small_den_;
+            const long long bc = small_den_ * that.small_num_;
+            return (ad > bc) - (ad < bc);
+        }
+
+        return numerator() * that.denominator() <=> denominator() * that.numerator();
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Convert the fraction to double type.
+    explicit operator double() const
+    {
+        if (is_small_)
+        {
+            return double(small_num_) / double(small_den_);
+        }
+
+        // scale the quotient to about 20 digits, enough for a double
+        const int scale = 20 - num_.digits() + den_.digits();
+        const Int quotient = scale >= 0 ? num_ * Int::pow(10, scale) / den_ : num_ / (den_ * Int::pow(10, -scale));
+        return quotient.to_double() * std::pow(10.0, -scale);
+    }
+
+    /// Get the numerator of this.
+    Int numerator() const
+    {
+        return is_small_ ? Int(small_num_) : num_;
+    }
+
+    /// Get the denominator of this.
+    Int denominator() const
+    {
+        return is_small_ ? Int(small_den_) : den_;
+    }
+
+    /// Determine whether the value is kept in machine words.
+    bool is_small() const
+    {
+        return is_small_;
+    }
+
+    /// Return the pair of the numerator and the denominator.
+    std::pair<Int, Int> as_integer_ratio() const
+    {
+        return {numerator(), denominator()};
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs`.
+    BigFraction& operator+=(const BigFraction& rhs)
+    {
+        if (is_small_ && rhs.is_small_)
+        {
+            auto [num, den] = add(small_num_, small_den_, rhs.small_num_, rhs.small_den_);
+            set_simplified(num, den);
+        }
+        else
+        {
+            auto [num, den] = add(numerator(), denominator(), rhs.numerator(), rhs.denominator());
+            set_simplified(std::move(num), std::move(den));
+        }
+        return *this;
+    }
+
+    /// Return this -= `rhs`.
+    BigFraction& operator-=(const BigFraction& rhs)
+    {
+        if (is_small_ && rhs.is_small_)
+        {
+            auto [num, den] = add(small_num_, small_den_, -rhs.small_num_, rhs.small_den_);
+            set_simplified(num, den);
+        }
+        else
+        {
+            auto [num, den] = add(numerator(), denominator(), -rhs.numerator(), rhs.denominator());
+            set_simplified(std::move(num), std::move(den));
+        }
+        return *this;
+    }
+
+    /// Return this *= `rhs`.
+    BigFraction& operator*=(const BigFraction& rhs)
+    {
+        if (is_small_ && rhs.is_small_)
+        {
+            auto [num, den] = mul(small_num_, small_den_, rhs.small_num_, rhs.small_den_);
+            set_simplified(num, den);
+        }
+        else
+        {
+            auto [num, den] = mul(numerator(), denominator(), rhs.numerator(), rhs.denominator());
+            set_simplified(std::move(num), std::move(den));
+        }
+        return *this;
+    }
+
+    /// Return this /= `rhs` (not zero).
+    BigFraction& operator/=(const BigFraction& rhs)
+    {
+        detail::check_zero(rhs);
+
+        // multiply by the reciprocal, with the sign moved to the numerator
+        if (is_small_ && rhs.is_small_)
+        {
+            const long long sign = rhs.small_num_ < 0 ? -1 : 1;
+            auto [num, den] = mul(small_num_, small_den_, rhs.small_den_ * sign, rhs.small_num_ * sign);
+            set_simplified(num, den);
+        }
+        else
+        {
+            Int c = rhs.denominator(), d = rhs.numerator();
+            if (d.is_negative())
+            {
+                c = -c;
+                d = -d;
+            }
+            auto [num, den] = mul(numerator(), denominator(), c, d);
+            set_simplified(std::move(num), std::move(den));
+        }
+        return *this;
+    }
+
+    /// Return this %= `rhs` (not zero).
+    BigFraction& operator%=(const BigFraction& rhs)
+    {
+        return *this = *this % rhs;
+    }
+
+    /// Increment the value by 1.
+    BigFraction& operator++()
+    {
+        return *this += 1;
+    }
+
+    /// Decrement the value by 1.
+    BigFraction& operator--()
+    {
+        return *this -= 1;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the copy of this.
+    BigFraction operator+() const
+    {
+        return *this;
+    }
+
+    /// Return the opposite value of this.
+    BigFraction operator-() const
+    {
+        BigFraction result = *this;
+        if (is_small_)
+        {
+            result.small_num_ = -small_num_;
+        }
+        else
+        {
+            result.num_ = -num_;
+        }
+        return result;
+    }
+
+    /// Return the absolute value of this.
+    BigFraction abs() const
+    {
+        BigFraction result = *this;
+        if (is_small_)
+        {
+            result.small_num_ = std::abs(small_num_);
+        }
+        else
+        {
+            result.num_ = num_.abs();
+        }
+        return result;
+    }
+
+    /// Return this + `rhs`.
+    BigFraction operator+(const BigFraction& rhs) const
+    {
+        return BigFraction(*this) += rhs;
+    }
+
+    /// Return this - `rhs`.
+    BigFraction operator-(const BigFraction& rhs) const
+    {
+        return BigFraction(*this) -= rhs;
+    }
+
+    /// Return this * `rhs`.
+    BigFraction operator*(const BigFraction& rhs) const
+    {
+        return BigFraction(*this) *= rhs;
+    }
+
+    /// Return this / `rhs` (not zero).
+    BigFraction operator/(const BigFraction& rhs) const
+    {
+        return BigFraction(*this) /= rhs;
+    }
+
+    /// Return this % `rhs` (not zero).
+    BigFraction operator%(const BigFraction& rhs) const
+    {
+        detail::check_zero(rhs);
+
+        if (is_small_ && rhs.is_small_)
+        {
+            return BigFraction((small_num_ * rhs.small_den_) % (rhs.small_num_ * small_den_), small_den_ * rhs.small_den_);
+        }
+
+        return BigFraction((numerator() * rhs.denominator()) % (rhs.numerator() * denominator()), denominator() * rhs.denominator());
+    }
+
+    /// Return the closest fraction to this with denominator at most `max_den`.
+    /// If `max_den` < 1, throw a `runtime_error`.
+    ///
+    /// ### Example
+    /// ```
+    /// BigFraction(3.141592653589793).limit_denominator(1000); // 355/113
+    /// ```
+    BigFraction limit_denominator(const Int& max_den) const
+    {
+        if (max_den < 1)
+        {
+            throw std::runtime_error("Error: Require max_den >= 1 for limit_denominator(max_den).");
+        }
+
+        if (is_small_ && max_den.digits() <= 10)
+        {
+            auto [num, den] = detail::limit_denominator<long long>(small_num_, small_den_, max_den.to_number<long long>());
+            return BigFraction(num, den);
+        }
+
+        auto [num, den] = detail::limit_denominator<Int>(numerator(), denominator(), max_den);
+        return BigFraction(num, den);
+    }
+
+    /// Calculate the greatest common divisor of two fractions.
+    static BigFraction gcd(const BigFraction& a, const BigFraction& b)
+    {
+        return detail::gcd(a, b);
+    }
+
+    /// Calculate the least common multiple of two fractions.
+    static BigFraction lcm(const BigFraction& a, const BigFraction& b)
+    {
+        if (a == 0 || b == 0)
+        {
+            return 0;
+        }
+
+        return (a * b).abs() / gcd(a, b); // LCM = |a * b| / GCD
+    }
+
+    /// Return the sum of fractions in range [`first`, `last`).
+    /// Fractions are added in pairs like a binary tree, so the operands of each addition have similar sizes
+    /// and the big multiplications happen only near the root, instead of once per element.
+    ///
+    /// ### Example
+    /// ```
+    /// List<BigFraction> list = {BigFraction(1, 2), BigFraction(1, 3), BigFraction(1, 6)};
+    /// BigFraction::sum(list.begin(), list.end()); // 1
+    /// ```
+    template <std::input_iterator InputIt>
+    static BigFraction sum(InputIt first, InputIt last)
+    {
+        std::vector<BigFraction> terms(first, last);
+        if (terms.empty())
+        {
+            return BigFraction();
+        }
+
+        for (std::size_t size = terms.size(); size > 1; size = (size + 1) / 2)
+        {
+            for (std::size_t i = 0; i < size / 2; ++i)
+            {
+                terms[i] = terms[2 * i] + terms[2 * i + 1];
+            }
+            if (size % 2 == 1)
+            {
+                terms[size / 2] = std::move(terms[size - 1]);
+            }
+        }
+
+        return std::move(terms[0]);
+    }
+
+    /*
+     * Print / Input
+     */
+
+    /// Output the fraction to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const BigFraction& fraction)
+    {
+        if (fraction.is_small_)
+        {
+            return fraction.small_den_ == 1 ? os << fraction.small_num_ : os << fraction.small_num_ << "/" << fraction.small_den_;
+        }
+
+        return fraction.den_ == 1 ? os << fraction.num_ : os << fraction.num_ << "/" << fraction.den_;
+    }
+
+    /// Get a fraction from the specified input stream.
+    ///
+    /// ### Example
+    /// ```
+    /// BigFraction f1, f2;
+    /// std::istringstream("+1/-2 123456789012345678901234567890") >> f1 >> f2;
+    /// // f1 == BigFraction(-1, 2);
+    /// // f2 == BigFraction("123456789012345678901234567890");
+    /// ```
+    friend std::istream& operator>>(std::istream& is, BigFraction& fraction)
+    {
+        std::string str;
+        is >> str;
+
+        // [+-]digits
+        auto is_integer = [](std::string_view part)
+        {
+            if (!part.empty() && (part[0] == '+' || part[0] == '-'))
+            {
+                part.remove_prefix(1);
+            }
+            return !part.empty() && std::all_of(part.begin(), part.end(), [](char c)
+                                                { return c >= '0' && c <= '9'; });
+        };
+
+        const std::size_t slash = str.find('/');
+        const std::string num = str.substr(0, slash);
+        const std::string den = slash == std::string::npos ? "1" : str.substr(slash + 1);
+        if (!is_integer(num) || !is_integer(den))
+        {
+            throw std::runtime_error("Error: Wrong fraction literal.");
+        }
+
+        fraction = BigFraction(num.c_str(), den.c_str());
+        return is;
+    }
+
+    friend struct std::hash<pyincpp::BigFraction>;
+};
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::BigFraction> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::BigFraction& fraction) const
+    {
+        if (fraction.is_small_)
+        {
+            const long long parts[] = {fraction.small_num_, fraction.small_den_};
+            return pyincpp::detail::hash_bytes(parts, sizeof(parts));
+        }
+
+        return pyincpp::detail::hash_mix(std::hash<pyincpp::Int>{}(fraction.num_), std::hash<pyincpp::Int>{}(fraction.den_));
+    }
+};
+
+#endif // BIG_FRACTION_HPP
@@ -1,277 +1,344 @@
-//! @file complex.hpp
-//! @author Chen QingYu <chen_qingyu@qq.com>
-//! @brief Complex class.
-//! @date 2024.05.22
-
-#ifndef COMPLEX_HPP
-#define COMPLEX_HPP
-
-#include "detail.hpp"
-
-namespace pyincpp
-{
-
-/// Complex provides support for complex number arithmetic.
-class Complex
-{
-private:
-    // Real part.
-    double real_;
-
-    // Imaginary part.
-    double imag_;
-
-public:
-    /*
-     * Constructor
-     */
-
-    /// Create a complex with value `real+imag*j`.
-    Complex(double real = 0, double imag = 0)
-        : real_(real)
-        , imag_(imag)
-    {
-    }
-
-    /// Copy constructor.
-    Complex(const Complex& that) = default;
-
-    /// Move constructor.
-    Complex(Complex&& that)
-        : real_(std::move(that.real_))
-        , imag_(std::move(that.imag_))
-    {
-        that.real_ = 0;
-        that.imag_ = 0;
-    }
-
-    /*
-     * Comparison
-     */
-
-    /// Compare the complex with another complex.
-    bool operator==(const Complex& that) const
-    {
-        constexpr double epsilon = std::numeric_limits<double>::epsilon();
-        return std::abs(real_ - that.real_) < epsilon && std::abs(imag_ - that.imag_) < epsilon;
-    }
-
-    /*
-     * Assignment
-     */
-
-    /// Copy assignment operator.
-    Complex& operator=(const Complex& that) = default;
-
-    /// Move assignment operator.
-    Complex& operator=(Complex&& that)
-    {
-        real_ = std::move(that.real_);
-        imag_ = std::move(that.imag_);
-
-        that.real_ = 0;
-        that.imag_ = 0;
-
-        return *this;
-    }
-
-    /*
-     * Examination
-     */
-
-    /// Return the real part.
-    double real() const
-    {
-        return real_;
-    }
-
-    /// Return the imaginary part.
-    double imag() const
-    {
-        return imag_;
-    }
-
-    /// Return the absolute value (distance from origin) of this.
-    double abs() const
-    {
-        return std::hypot(real_, imag_);
-    }
-
-    /// Return the phase angle (in radians) of this.
-    double arg() const
-    {
-        return std::atan2(imag_, real_);
-    }
-
-    /*
-     * Manipulation
-     */
-
-    /// Return this += `rhs`.
-    Complex& operator+=(const Complex& rhs)
-    {
-        return *this = *this + rhs;
-    }
-
-    /// Return this -= `rhs`.
-    Complex& operator-=(const Complex& rhs)
-    {
-        return *this = *this - rhs;
-    }
-
-    /// Return this *= `rhs`.
-    Complex& operator*=(const Complex& rhs)
-    {
-        return *this = *this * rhs;
-    }
-
-    /// Return this /= `rhs` (not zero).
-    Complex& operator/=(const Complex& rhs)
-    {
-        return *this = *this / rhs;
-    }
-
-    /*
-     * Production
-     */
-
-    /// Return the copy of this.
-    Complex operator+() const
-    {
-        return *this;
-    }
-
-    /// Return the opposite value of this.
-    Complex operator-() const
-    {
-        return Complex(-real_, -imag_);
-    }
-
-    /// Return the conjugate value of this.
-    Complex conjugate() const
-    {
-        return Complex(real_, -imag_);
-    }
-
-    /// Return this + `rhs`.
-    Complex operator+(const Complex& rhs) const
-    {
-        return Complex(real_ + rhs.real_, imag_ + rhs.imag_);
-    }
-
-    /// Return this - `rhs`.
-    Complex operator-(const Complex& rhs) const
-    {
-        return Complex(real_ - rhs.real_, imag_ - rhs.imag_);
-    }
-
-    /// Return this * `rhs`.
-    Complex operator*(const Complex& rhs) const
-    {
-        return Complex(real_ * rhs.real_ - imag_ * rhs.imag_, real_ * rhs.imag_ + imag_ * rhs.real_);
-    }
-
-    /// Return this / `rhs` (not zero).
-    Complex operator/(const Complex& rhs) const
-    {
-        detail::check_zero(rhs);
-
-        double den = rhs.real_ * rhs.real_ + rhs.imag_ * rhs.imag_;
-        return Complex((real_ * rhs.real_ + imag_ * rhs.imag_) / den, (imag_ * rhs.real_ - real_ * rhs.imag_) / den);
-    }
-
-    /*
-     * Static
-     */
-
-    /// Return `base**exp`.
-    static Complex pow(const Complex& base, const Complex& exp)
-    {
-        if (exp == 0)
-        {
-            return 1;
-        }
-
-        if (base == 0)
-        {
-            throw std::runtime_error("Error: Math domain error.");
-        }
-
-        double coef = std::pow(base.abs(), exp.real_) * std::exp(-base.arg() * exp.imag_);
-        double theta = std::log(base.abs()) * exp.imag_ + base.arg() * exp.real_;
-
-        return Complex(coef * std::cos(theta), coef * std::sin(theta));
-    }
-
-    /*
-     * Print / Input
-     */
-
-    /// Output the complex to the specified output stream.
-    friend std::ostream& operator<<(std::ostream& os, const Complex& complex)
-    {
-        return os << '(' << complex.real_ << (complex.imag_ < 0 ? '-' : '+') << std::abs(complex.imag_) << "j)";
-    }
-
-    /// Get a complex from the specified input stream.
-    ///
-    /// ### Example
-    /// ```
-    /// Complex c1, c2;
-    /// std::istringstream("1-2j 233.33") >> c1 >> c2;
-    /// // c1 == Complex(1, -2);
-    /// // c2 == Complex(233.33);
-    /// ```
-    friend std::istream& operator>>(std::istream& is, Complex& complex)
-    {
-        while (is.peek() <= 0x20)
-        {
-            is.ignore();
-        }
-        if (!(std::isdigit(is.peek()) || is.peek() == '-' || is.peek() == '+' || is.peek() == '.')) // handle "z1+2j"
-        {
-            throw std::runtime_error("Error: Wrong complex literal.");
-        }
-
-        double real;
-        is >> real;
-        if (is.peek() <= 0x20) // next char is white space, ok
-        {
-            complex = real;
-            return is;
-        }
-        if (is.peek() == 'j') // next char is 'j', ok
-        {
-            is.get();
-            if (is.peek() <= 0x20) // next char is white space, ok
-            {
-                complex = Complex(0, real);
-                return is;
-            }
-            throw std::runtime_error("Error: Wrong complex literal.");
-        }
-
-        double imag;
-        char c;
-        is >> imag >> c;
-        if (c != 'j' || is.peek() > 0x20) // handle "1z+2j" or "1+z2j" or "1+2zj" or "1jj2j"
-        {
-            throw std::runtime_error("Error: Wrong complex literal.");
-        }
-        complex = Complex(real, imag);
-        return is;
-    }
-};
-
-} // namespace pyincpp
-
-template <>
-struct std::hash<pyincpp::Complex> // explicit specialization
-{
-    std::size_t operator()(const pyincpp::Complex& complex) const
-    {
-        return std::hash<double>{}(complex.real()) ^ (std::hash<double>{}(complex.imag()) << 1);
-    }
-};
-
-#endif // COMPLEX_HPP
+//! @file complex.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Complex class.
+//! @date 2024.05.22
+
+#ifndef COMPLEX_HPP
+#define COMPLEX_HPP
+
+#include "detail.hpp"
+
+namespace pyincpp
+{
+
+/// Complex provides support for complex number arithmetic.
+class Complex
+{
+private:
+    // Real part.
+    double real_;
+
+    // Imaginary part.
+    double imag_;
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create a complex with value `real+imag*j`.
+    Complex(double real = 0, double imag = 0)
+        : real_(real)
+        , imag_(imag)
+    {
+    }
+
+    /// Copy constructor.
+    Complex(const Complex& that) = default;
+
+    /// Move constructor.
+    Complex(Complex&& that)
+        : real_(std::move(that.real_))
+        , imag_(std::move(that.imag_))
+    {
+        that.real_ = 0;
+        that.imag_ = 0;
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Compare the complex with another complex.
+    bool operator==(const Complex& that) const
+    {
+        constexpr double epsilon = std::numeric_limits<double>::epsilon();
+        return std::abs(real_ - that.real_) < epsilon && std::abs(imag_ - that.imag_) < epsilon;
+    }
+
+    /*
+     * Assignment
+     */
+
+    /// Copy assignment operator.
+    Complex& operator=(const Complex& that) = default;
+
+    /// Move assignment operator.
+    Complex& operator=(Complex&& that)
+    {
+        real_ = std::move(that.real_);
+        imag_ = std::move(that.imag_);
+
+        that.real_ = 0;
+        that.imag_ = 0;
+
+        return *this;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the real part.
+    double real() const
+    {
+        return real_;
+    }
+
+    /// Return the imaginary part.
+    double imag() const
+    {
+        return imag_;
+    }
+
+    /// Return the absolute value (distance from origin) of this.
+    double abs() const
+    {
+        return std::hypot(real_, imag_);
+    }
+
+    /// Return the phase angle (in radians) of this.
+    double arg() const
+    {
+        return std::atan2(imag_, real_);
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs`.
+    Complex& operator+=(const Complex& rhs)
+    {
+        return *this = *this + rhs;
+    }
+
+    /// Return this -= `rhs`.
+    Complex& operator-=(const Complex& rhs)
+    {
+        return *this = *this - rhs;
+    }
+
+    /// Return this *= `rhs`.
+    Complex& operator*=(const Complex& rhs)
+    {
+        return *this = *this * rhs;
+    }
+
+    /// Return this /= `rhs` (not zero).
+    Complex& operator/=(const Complex& rhs)
+    {
+        return *this = *this / rhs;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the copy of this.
+    Complex operator+() const
+    {
+        return *this;
+    }
+
+    /// Return the opposite value of this.
+    Complex operator-() const
+    {
+        return Complex(-real_, -imag_);
+    }
+
+    /// Return the conjugate value of this.
+    Complex conjugate() const
+    {
+        return Complex(real_, -imag_);
+    }
+
+    /// Return this + `rhs`.
+    Complex operator+(const Complex& rhs) const
+    {
+        return Complex(real_ + rhs.real_, imag_ + rhs.imag_);
+    }
+
+    /// Return this - `rhs`.
+    Complex operator-(const Complex& rhs) const
+    {
+        return Complex(real_ - rhs.real_, imag_ - rhs.imag_);
+    }
+
+    /// Return this * `rhs`.
+    Complex operator*(const Complex& rhs) const
+    {
+        return Complex(real_ * rhs.real_ - imag_ * rhs.imag_, real_ * rhs.imag_ + imag_ * rhs.real_);
+    }
+
+    /// Return this / `rhs` (not zero).
+    Complex operator/(const Complex& rhs) const
+    {
+        detail::check_zero(rhs);
+
+        double den = rhs.real_ * rhs.real_ + rhs.imag_ * rhs.imag_;
+        return Complex((real_ * rhs.real_ + imag_ * rhs.imag_) / den, (imag_ * rhs.real_ - real_ * rhs.imag_) / den);
+    }
+
+    /*
+     * Static
+     */
+
+    /// Return `base**exp`.
+    /// A real integer `exp` is computed by binary exponentiation, which is faster and more precise.
+    static Complex pow(const Complex& base, const Complex& exp)
+    {
+        if (exp == 0)
+        {
+            return 1;
+        }
+
+        if (exp.imag_ == 0 && exp.real_ == std::trunc(exp.real_) && std::abs(exp.real_) <= INT_MAX)
+        {
+            Complex result = 1;
+            Complex power = base;
+            for (long long n = std::abs((long long)exp.real_); n > 0; n >>= 1)
+            {
+                if (n & 1)
+                {
+                    result *= power;
+                }
+                if (n > 1)
+                {
+                    power *= power;
+                }
+            }
+            return exp.real_ > 0 ? result : Complex(1) / result;
+        }
+
+        if (base == 0)
+        {
+            throw std::runtime_error("Error: Math domain error.");
+        }
+
+        double coef = std::pow(base.abs(), exp.real_) * std::exp(-base.arg() * exp.imag_);
+        double theta = std::log(base.abs()) * exp.imag_ + base.arg() * exp.real_;
+
+        return Complex(coef * std::cos(theta), coef * std::sin(theta));
+    }
+
+    /// Return e raised to the power `z`.
+    static Complex exp(const Complex& z)
+    {
+        const double modulus = std::exp(z.real_);
+        return Complex(modulus * std::cos(z.imag_), modulus * std::sin(z.imag_));
+    }
+
+    /// Return the natural logarithm of `z` (not zero), with the imaginary part in [-π, π].
+    static Complex log(const Complex& z)
+    {
+        if (z.real_ == 0 && z.imag_ == 0)
+        {
+            throw std::runtime_error("Error: Math domain error.");
+        }
+
+        return Complex(std::log(z.abs()), z.arg());
+    }
+
+    /// Return the square root of `z`, with the real part non-negative.
+    static Complex sqrt(const Complex& z)
+    {
+        if (z.real_ == 0 && z.imag_ == 0)
+        {
+            return Complex(0, z.imag_);
+        }
+
+        // s = sqrt((|x| + |z|) / 2) has no cancellation, the other part is y / 2s
+        const double s = std::sqrt((std::abs(z.real_) + z.abs()) / 2);
+        if (z.real_ >= 0)
+        {
+            return Complex(s, z.imag_ / (2 * s));
+        }
+        return Complex(std::abs(z.imag_) / (2 * s), std::copysign(s, z.imag_));
+    }
+
+    /// Return the sine of `z`.
+    static Complex sin(const Complex& z)
+    {
+        return Complex(std::sin(z.real_) * std::cosh(z.imag_), std::cos(z.real_) * std::sinh(z.imag_));
+    }
+
+    /// Return the cosine of `z`.
+    static Complex cos(const Complex& z)
+    {
+        return Complex(std::cos(z.real_) * std::cosh(z.imag_), -std::sin(z.real_) * std::sinh(z.imag_));
+    }
+
+    /*
+     * Print / Input
+     */
+
+    /// Output the complex to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const Complex& complex)
+    {
+        return os << '(' << complex.real_ << (complex.imag_ < 0 ? '-' : '+') << std::abs(complex.imag_) << "j)";
+    }
+
+    /// Get a complex from the specified input stream.
+    ///
+    /// ### Example
+    /// ```
+    /// Complex c1, c2;
+    /// std::istringstream("1-2j 233.33") >> c1 >> c2;
+    /// // c1 == Complex(1, -2);
+    /// // c2 == Complex(233.33);
+    /// ```
+    friend std::istream& operator>>(std::istream& is, Complex& complex)
+    {
+        while (is.peek() <= 0x20)
+        {
+            is.ignore();
+        }
+        if (!(std::isdigit(is.peek()) || is.peek() == '-' || is.peek() == '+' || is.peek() == '.')) // handle "z1+2j"
+        {
+            throw std::runtime_error("Error: Wrong complex literal.");
+        }
+
+        double real;
+        is >> real;
+        if (is.peek() <= 0x20) // next char is white space, ok
+        {
+            complex = real;
+            return is;
+        }
+        if (is.peek() == 'j') // next char is 'j', ok
+        {
+            is.get();
+            if (is.peek() <= 0x20) // next char is white space, ok
+            {
+                complex = Complex(0, real);
+                return is;
+            }
+            throw std::runtime_error("Error: Wrong complex literal.");
+        }
+
+        double imag;
+        char c;
+        is >> imag >> c;
+        if (c != 'j' || is.peek() > 0x20) // handle "1z+2j" or "1+z2j" or "1+2zj" or "1jj2j"
+        {
+            throw std::runtime_error("Error: Wrong complex literal.");
+        }
+        complex = Complex(real, imag);
+        return is;
+    }
+};
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::Complex> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::Complex& complex) const
+    {
+        const double parts[] = {complex.real() + 0.0, complex.imag() + 0.0}; // -0.0 + 0.0 == +0.0, equal values hash equally
+        return pyincpp::detail::hash_bytes(parts, sizeof(parts));
+    }
+};
+
+#endif // COMPLEX_HPP
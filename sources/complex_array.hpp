@@ -0,0 +1,549 @@
+//! @file complex_array.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief ComplexArray class.
+//! @date 2026.10.17
+
+#ifndef COMPLEX_ARRAY_HPP
+#define COMPLEX_ARRAY_HPP
+
+#include "detail.hpp"
+
+#include "complex.hpp"
+#include "list.hpp"
+
+namespace pyincpp
+{
+
+/// ComplexArray is an array of complex numbers with the real and imaginary parts in two separate buffers,
+/// so elementwise arithmetic runs on contiguous doubles instead of one Complex object at a time.
+/// Kernels process four elements per instruction when compiled with AVX2 (e.g. `-mavx2`), and fall back to plain loops otherwise.
+class ComplexArray
+{
+private:
+    // Real parts.
+    std::vector<double> real_;
+
+    // Imaginary parts.
+    std::vector<double> imag_;
+
+    // Check whether the sizes of two arrays are the same.
+    void check_size(const ComplexArray& that) const
+    {
+        if (size() != that.size())
+        {
+            throw std::runtime_error("Error: The sizes of two arrays are different.");
+        }
+    }
+
+    // out = a + b for `n` doubles.
+    static void add(const double* a, const double* b, double* out, int n)
+    {
+        int i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= n; i += 4)
+        {
+            _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        }
+#endif
+        for (; i < n; ++i)
+        {
+            out[i] = a[i] + b[i];
+        }
+    }
+
+    // out = a - b for `n` doubles.
+    static void sub(const double* a, const double* b, double* out, int n)
+    {
+        int i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= n; i += 4)
+        {
+            _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        }
+#endif
+        for (; i < n; ++i)
+        {
+            out[i] = a[i] - b[i];
+        }
+    }
+
+    // (out_re, out_im) = (a_re, a_im) * (b_re, b_im) for `n` complexes, the output may alias the input.
+    static void mul(const double* a_re, const double* a_im, const double* b_re, const double* b_im, double* out_re, double* out_im, int n)
+    {
+        int i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m256d ar = _mm256_loadu_pd(a_re + i), ai = _mm256_loadu_pd(a_im + i);
+            const __m256d br = _mm256_loadu_pd(b_re + i), bi = _mm256_loadu_pd(b_im + i);
+            _mm256_storeu_pd(out_re + i, _mm256_sub_pd(_mm256_mul_pd(ar, br), _mm256_mul_pd(ai, bi)));
+            _mm256_storeu_pd(out_im + i, _mm256_add_pd(_mm256_mul_pd(ar, bi), _mm256_mul_pd(ai, br)));
+        }
+#endif
+        for (; i < n; ++i)
+        {
+            const double re = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+            const double im = a_re[i] * b_im[i] + a_im[i] * b_re[i];
+            out_re[i] = re;
+            out_im[i] = im;
+        }
+    }
+
+    // (out_re, out_im) = (a_re, a_im) / (b_re, b_im) for `n` complexes, the output may alias the input.
+    static void div(const double* a_re, const double* a_im, const double* b_re, const double* b_im, double* out_re, double* out_im, int n)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            detail::check_zero(Complex(b_re[i], b_im[i]));
+        }
+
+        int i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m256d ar = _mm256_loadu_pd(a_re + i), ai = _mm256_loadu_pd(a_im + i);
+            const __m256d br = _mm256_loadu_pd(b_re + i), bi = _mm256_loadu_pd(b_im + i);
+            const __m256d den = _mm256_add_pd(_mm256_mul_pd(br, br), _mm256_mul_pd(bi, bi));
+            _mm256_storeu_pd(out_re + i, _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(ar, br), _mm256_mul_pd(ai, bi)), den));
+            _mm256_storeu_pd(out_im + i, _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(ai, br), _mm256_mul_pd(ar, bi)), den));
+        }
+#endif
+        for (; i < n; ++i)
+        {
+            const double den = b_re[i] * b_re[i] + b_im[i] * b_im[i];
+            const double re = (a_re[i] * b_re[i] + a_im[i] * b_im[i]) / den;
+            const double im = (a_im[i] * b_re[i] - a_re[i] * b_im[i]) / den;
+            out_re[i] = re;
+            out_im[i] = im;
+        }
+    }
+
+    // Return the array of `function` applied to each element of `array`, a loop over the split buffers
+    // that the compiler can vectorize when the math functions have vector versions (e.g. glibc's libmvec).
+    template <typename F>
+    static ComplexArray apply(const ComplexArray& array, F function)
+    {
+        ComplexArray result(array.size());
+        for (int i = 0; i < array.size(); ++i)
+        {
+            const Complex value = function(Complex(array.real_[i], array.imag_[i]));
+            result.real_[i] = value.real();
+            result.imag_[i] = value.imag();
+        }
+        return result;
+    }
+
+    // Return the sum of `n` doubles, accumulated in four lanes.
+    static double total(const double* a, int n)
+    {
+        double result = 0;
+        int i = 0;
+#ifdef __AVX2__
+        __m256d acc = _mm256_setzero_pd();
+        for (; i + 4 <= n; i += 4)
+        {
+            acc = _mm256_add_pd(acc, _mm256_loadu_pd(a + i));
+        }
+        double lanes[4];
+        _mm256_storeu_pd(lanes, acc);
+        result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+        for (; i < n; ++i)
+        {
+            result += a[i];
+        }
+        return result;
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty array.
+    ComplexArray() = default;
+
+    /// Create an array of `size` copies of `value`.
+    explicit ComplexArray(int size, const Complex& value = 0)
+        : real_(size, value.real())
+        , imag_(size, value.imag())
+    {
+    }
+
+    /// Create an array with the contents of the initializer list `init`.
+    ComplexArray(const std::initializer_list<Complex>& init)
+        : ComplexArray(List<Complex>(init))
+    {
+    }
+
+    /// Create an array with the contents of the list.
+    explicit ComplexArray(const List<Complex>& list)
+    {
+        real_.reserve(list.size());
+        imag_.reserve(list.size());
+        for (const auto& complex : list)
+        {
+            real_.push_back(complex.real());
+            imag_.push_back(complex.imag());
+        }
+    }
+
+    /// Create an array with the real parts `real` and the imaginary parts `imag` of the same size.
+    ComplexArray(const List<double>& real, const List<double>& imag)
+        : real_(real.begin(), real.end())
+        , imag_(imag.begin(), imag.end())
+    {
+        if (real_.size() != imag_.size())
+        {
+            throw std::runtime_error("Error: The sizes of two arrays are different.");
+        }
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this array is equal to another array, element by element like Complex.
+    bool operator==(const ComplexArray& that) const
+    {
+        if (size() != that.size())
+        {
+            return false;
+        }
+
+        for (int i = 0; i < size(); ++i)
+        {
+            if ((*this)[i] != that[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the element at the specified position in the array.
+    /// Index can be negative, like Python's list: array[-1] gets the last element.
+    Complex operator[](int index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        index = index >= 0 ? index : index + size();
+        return Complex(real_[index], imag_[index]);
+    }
+
+    /// Set the element at the specified position in the array to `value`.
+    /// Index can be negative.
+    void set(int index, const Complex& value)
+    {
+        detail::check_bounds(index, -size(), size());
+
+        index = index >= 0 ? index : index + size();
+        real_[index] = value.real();
+        imag_[index] = value.imag();
+    }
+
+    /// Return the buffer of the real parts.
+    std::span<double> real()
+    {
+        return real_;
+    }
+
+    /// Return the const buffer of the real parts.
+    std::span<const double> real() const
+    {
+        return real_;
+    }
+
+    /// Return the buffer of the imaginary parts.
+    std::span<double> imag()
+    {
+        return imag_;
+    }
+
+    /// Return the const buffer of the imaginary parts.
+    std::span<const double> imag() const
+    {
+        return imag_;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of elements in the array.
+    int size() const
+    {
+        return real_.size();
+    }
+
+    /// Return `true` if the array contains no elements.
+    bool is_empty() const
+    {
+        return real_.empty();
+    }
+
+    /// Return the sum of the elements.
+    Complex sum() const
+    {
+        return Complex(total(real_.data(), size()), total(imag_.data(), size()));
+    }
+
+    /// Return the sum of the products of the elements of two arrays of the same size.
+    Complex dot(const ComplexArray& that) const
+    {
+        check_size(that);
+
+        double re = 0, im = 0;
+        int i = 0;
+#ifdef __AVX2__
+        __m256d acc_re = _mm256_setzero_pd(), acc_im = _mm256_setzero_pd();
+        for (; i + 4 <= size(); i += 4)
+        {
+            const __m256d ar = _mm256_loadu_pd(&real_[i]), ai = _mm256_loadu_pd(&imag_[i]);
+            const __m256d br = _mm256_loadu_pd(&that.real_[i]), bi = _mm256_loadu_pd(&that.imag_[i]);
+            acc_re = _mm256_add_pd(acc_re, _mm256_sub_pd(_mm256_mul_pd(ar, br), _mm256_mul_pd(ai, bi)));
+            acc_im = _mm256_add_pd(acc_im, _mm256_add_pd(_mm256_mul_pd(ar, bi), _mm256_mul_pd(ai, br)));
+        }
+        double lanes_re[4], lanes_im[4];
+        _mm256_storeu_pd(lanes_re, acc_re);
+        _mm256_storeu_pd(lanes_im, acc_im);
+        re = (lanes_re[0] + lanes_re[1]) + (lanes_re[2] + lanes_re[3]);
+        im = (lanes_im[0] + lanes_im[1]) + (lanes_im[2] + lanes_im[3]);
+#endif
+        for (; i < size(); ++i)
+        {
+            re += real_[i] * that.real_[i] - imag_[i] * that.imag_[i];
+            im += real_[i] * that.imag_[i] + imag_[i] * that.real_[i];
+        }
+
+        return Complex(re, im);
+    }
+
+    /// Return the absolute values of the elements, computed as sqrt(real^2 + imag^2).
+    List<double> abs() const
+    {
+        std::vector<double> result(size());
+        int i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= size(); i += 4)
+        {
+            const __m256d re = _mm256_loadu_pd(&real_[i]), im = _mm256_loadu_pd(&imag_[i]);
+            _mm256_storeu_pd(&result[i], _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(re, re), _mm256_mul_pd(im, im))));
+        }
+#endif
+        for (; i < size(); ++i)
+        {
+            result[i] = std::sqrt(real_[i] * real_[i] + imag_[i] * imag_[i]);
+        }
+
+        return List<double>(std::move(result));
+    }
+
+    /// Return the phase angles (in radians) of the elements.
+    List<double> arg() const
+    {
+        std::vector<double> result(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            result[i] = std::atan2(imag_[i], real_[i]);
+        }
+
+        return List<double>(std::move(result));
+    }
+
+    /// Return the list of the elements.
+    List<Complex> to_list() const
+    {
+        std::vector<Complex> result;
+        result.reserve(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            result.emplace_back(real_[i], imag_[i]);
+        }
+
+        return List<Complex>(std::move(result));
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs` elementwise.
+    ComplexArray& operator+=(const ComplexArray& rhs)
+    {
+        check_size(rhs);
+
+        add(real_.data(), rhs.real_.data(), real_.data(), size());
+        add(imag_.data(), rhs.imag_.data(), imag_.data(), size());
+        return *this;
+    }
+
+    /// Return this -= `rhs` elementwise.
+    ComplexArray& operator-=(const ComplexArray& rhs)
+    {
+        check_size(rhs);
+
+        sub(real_.data(), rhs.real_.data(), real_.data(), size());
+        sub(imag_.data(), rhs.imag_.data(), imag_.data(), size());
+        return *this;
+    }
+
+    /// Return this *= `rhs` elementwise.
+    ComplexArray& operator*=(const ComplexArray& rhs)
+    {
+        check_size(rhs);
+
+        mul(real_.data(), imag_.data(), rhs.real_.data(), rhs.imag_.data(), real_.data(), imag_.data(), size());
+        return *this;
+    }
+
+    /// Return this /= `rhs` (no zero element) elementwise.
+    ComplexArray& operator/=(const ComplexArray& rhs)
+    {
+        check_size(rhs);
+
+        div(real_.data(), imag_.data(), rhs.real_.data(), rhs.imag_.data(), real_.data(), imag_.data(), size());
+        return *this;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the copy of this.
+    ComplexArray operator+() const
+    {
+        return *this;
+    }
+
+    /// Return the opposite values of this.
+    ComplexArray operator-() const
+    {
+        return ComplexArray(size()) - *this;
+    }
+
+    /// Return the conjugate values of this.
+    ComplexArray conjugate() const
+    {
+        ComplexArray result(*this);
+        int i = 0;
+#ifdef __AVX2__
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        for (; i + 4 <= size(); i += 4)
+        {
+            _mm256_storeu_pd(&result.imag_[i], _mm256_xor_pd(_mm256_loadu_pd(&imag_[i]), sign));
+        }
+#endif
+        for (; i < size(); ++i)
+        {
+            result.imag_[i] = -imag_[i];
+        }
+
+        return result;
+    }
+
+    /// Return this + `rhs` elementwise.
+    ComplexArray operator+(const ComplexArray& rhs) const
+    {
+        return ComplexArray(*this) += rhs;
+    }
+
+    /// Return this - `rhs` elementwise.
+    ComplexArray operator-(const ComplexArray& rhs) const
+    {
+        return ComplexArray(*this) -= rhs;
+    }
+
+    /// Return this * `rhs` elementwise.
+    ComplexArray operator*(const ComplexArray& rhs) const
+    {
+        return ComplexArray(*this) *= rhs;
+    }
+
+    /// Return this / `rhs` (no zero element) elementwise.
+    ComplexArray operator/(const ComplexArray& rhs) const
+    {
+        return ComplexArray(*this) /= rhs;
+    }
+
+    /*
+     * Static
+     */
+
+    /// Return `base**exp` elementwise.
+    /// An integer `exp` is computed by binary exponentiation with the multiplication kernel,
+    /// others go through Complex::pow for each element.
+    static ComplexArray pow(const ComplexArray& base, const Complex& exp)
+    {
+        const double n = exp.real();
+        if (exp.imag() != 0 || n != std::trunc(n) || std::abs(n) > INT_MAX)
+        {
+            return apply(base, [&](const Complex& z) { return Complex::pow(z, exp); });
+        }
+
+        ComplexArray result(base.size(), 1);
+        ComplexArray power(base);
+        for (long long e = std::abs((long long)n); e > 0; e >>= 1)
+        {
+            if (e & 1)
+            {
+                result *= power;
+            }
+            if (e > 1)
+            {
+                power *= power;
+            }
+        }
+
+        return n >= 0 ? result : ComplexArray(base.size(), 1) / result;
+    }
+
+    /// Return e raised to the power of each element.
+    static ComplexArray exp(const ComplexArray& array)
+    {
+        return apply(array, Complex::exp);
+    }
+
+    /// Return the natural logarithm of each element (not zero).
+    static ComplexArray log(const ComplexArray& array)
+    {
+        return apply(array, Complex::log);
+    }
+
+    /// Return the square root of each element.
+    static ComplexArray sqrt(const ComplexArray& array)
+    {
+        return apply(array, Complex::sqrt);
+    }
+
+    /// Return the sine of each element.
+    static ComplexArray sin(const ComplexArray& array)
+    {
+        return apply(array, Complex::sin);
+    }
+
+    /// Return the cosine of each element.
+    static ComplexArray cos(const ComplexArray& array)
+    {
+        return apply(array, Complex::cos);
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the array to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const ComplexArray& array)
+    {
+        return os << array.to_list();
+    }
+};
+
+} // namespace pyincpp
+
+#endif // COMPLEX_ARRAY_HPP
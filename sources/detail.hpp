@@ -1,126 +1,311 @@
-//! @file detail.hpp
-//! @author Chen QingYu <chen_qingyu@qq.com>
-//! @brief The internal details of PyInCpp.
-//! @date 2023.01.05
-
-#ifndef DETAIL_HPP
-#define DETAIL_HPP
-
-#include <algorithm>   // std::copy std::find std::rotate ...
-#include <cassert>     // assert
-#include <climits>     // INT_MAX
-#include <cmath>       // std::abs std::pow std::sqrt ...
-#include <concepts>    // std::integral
-#include <cstring>     // std::strlen
-#include <iomanip>     // std::setw std::setfill
-#include <istream>     // std::istream
-#include <iterator>    // std::input_iterator
-#include <limits>      // std::numeric_limits
-#include <numeric>     // std::gcd
-#include <ostream>     // std::ostream
-#include <random>      // std::random_device std::mt19937 ...
-#include <ranges>      // std::views::reverse
-#include <sstream>     // std::ostringstream
-#include <stdexcept>   // std::runtime_error
-#include <string>      // std::string std::getline
-#include <string_view> // std::string_view
-#include <utility>     // std::initializer_list std::move
-#include <vector>      // std::vector
-
-namespace pyincpp::detail
-{
-
-// Check whether the index is valid (begin <= pos < end).
-static inline void check_bounds(int pos, int begin, int end)
-{
-    if (pos < begin || pos >= end)
-    {
-        throw std::runtime_error("Error: Index out of range.");
-    }
-}
-
-// Check whether the container is not empty.
-static inline void check_empty(int size)
-{
-    if (size == 0)
-    {
-        throw std::runtime_error("Error: The container is empty.");
-    }
-}
-
-// Check whether there is any remaining capacity.
-static inline void check_full(int size, int capacity)
-{
-    if (size >= capacity)
-    {
-        throw std::runtime_error("Error: The container has reached the maximum size.");
-    }
-}
-
-// Check whether the number is not zero.
-template <typename T>
-static inline void check_zero(T number)
-{
-    if (number == T(0))
-    {
-        throw std::runtime_error("Error: Divide by zero.");
-    }
-}
-
-// Print helper for Pair.
-// This function can only be placed here because of the header file reference order.
-template <typename K, typename V>
-std::ostream& operator<<(std::ostream& os, const std::pair<const K, V>& pair)
-{
-    return os << pair.first << ": " << pair.second;
-}
-
-// Print helper for range [`first`, `last`).
-template <std::input_iterator InputIt>
-static inline std::ostream& print(std::ostream& os, const InputIt& first, const InputIt& last, char open, char close)
-{
-    // This form looks complex, but there is only one judgment in the loop.
-    // At the Assembly level (see https://godbolt.org/z/qT9n7GKf8), this is more efficient
-    // than the usual short form of the generated machine code under O3-level optimization.
-    // The inspiration comes from Java source code.
-
-    if (first == last)
-    {
-        return os << open << close;
-    }
-
-    os << open;
-    auto it = first;
-    while (true)
-    {
-        os << *it++;
-        if (it == last)
-        {
-            return os << close;
-        }
-        os << ", ";
-    }
-}
-
-// Get the GCD of numbers for generics.
-template <typename T>
-static inline T gcd(T a, T b)
-{
-    // using Euclidean algorithm
-
-    a = a.abs();
-    b = b.abs();
-
-    while (b != 0) // a, b = b, a % b until b == 0
-    {
-        auto t = b;
-        b = a % b;
-        a = t;
-    }
-
-    return a; // a is the GCD
-}
-
-} // namespace pyincpp::detail
-
-#endif // DETAIL_HPP
+//! @file detail.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief The internal details of PyInCpp.
+//! @date 2023.01.05
+
+#ifndef DETAIL_HPP
+#define DETAIL_HPP
+
+#include <algorithm>       // std::copy std::find std::rotate ...
+#include <array>           // std::array
+#include <atomic>          // std::atomic
+#include <bit>             // std::endian std::countr_zero
+#include <cassert>         // assert
+#include <charconv>        // std::to_chars_result std::from_chars_result
+#include <climits>         // INT_MAX
+#include <cmath>           // std::abs std::pow std::sqrt ...
+#include <concepts>        // std::integral
+#include <cstdint>         // std::uint64_t
+#include <cstring>         // std::memcpy std::strlen
+#include <deque>           // std::deque
+#include <future>          // std::async
+#include <iomanip>         // std::setw std::setfill
+#include <istream>         // std::istream
+#include <iterator>        // std::input_iterator
+#include <limits>          // std::numeric_limits
+#include <memory>          // std::allocator
+#include <memory_resource> // std::pmr::memory_resource
+#include <numeric>         // std::gcd
+#include <ostream>         // std::ostream
+#include <random>          // std::random_device std::mt19937 ...
+#include <ranges>          // std::views::reverse
+#include <span>            // std::span
+#include <sstream>         // std::ostringstream
+#include <stdexcept>       // std::runtime_error
+#include <string>          // std::string std::getline
+#include <string_view>     // std::string_view
+#include <utility>         // std::initializer_list std::move
+#include <vector>          // std::vector
+
+#if __has_include(<format>)
+#include <format> // std::formatter
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h> // _mm256_add_pd _mm256_mul_pd ...
+#endif
+
+namespace pyincpp::detail
+{
+
+// Check whether the index is valid (begin <= pos < end).
+static inline void check_bounds(int pos, int begin, int end)
+{
+    if (pos < begin || pos >= end)
+    {
+        throw std::runtime_error("Error: Index out of range.");
+    }
+}
+
+// Check whether the container is not empty.
+static inline void check_empty(int size)
+{
+    if (size == 0)
+    {
+        throw std::runtime_error("Error: The container is empty.");
+    }
+}
+
+// Check whether there is any remaining capacity.
+static inline void check_full(int size, int capacity)
+{
+    if (size >= capacity)
+    {
+        throw std::runtime_error("Error: The container has reached the maximum size.");
+    }
+}
+
+// Check whether the number is not zero.
+template <typename T>
+static inline constexpr void check_zero(T number)
+{
+    if (number == T(0))
+    {
+        throw std::runtime_error("Error: Divide by zero.");
+    }
+}
+
+// Multiply two 64-bit words and fold the 128-bit product by xor, the mixing step of wyhash.
+static inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t a_lo = a & 0xffffffff, a_hi = a >> 32, b_lo = b & 0xffffffff, b_hi = b >> 32;
+    const std::uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    const std::uint64_t middle = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+    return ((middle << 32) | (lo_lo & 0xffffffff)) ^ (hi_hi + (hi_lo >> 32) + (middle >> 32));
+#endif
+}
+
+// Hash `size` bytes from `data` with `seed`, a simplified wyhash that mixes 16 bytes per multiplication.
+// See: https://github.com/wangyi-fudan/wyhash
+static inline std::size_t hash_bytes(const void* data, std::size_t size, std::uint64_t seed = 0)
+{
+    constexpr std::uint64_t SECRET[] = {0xa0761d6478bd642f, 0xe7037ed1a0b428db, 0x8ebc6af09c88c6e3};
+
+    auto read = [](const unsigned char* p)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, p, 8);
+        return word;
+    };
+
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::size_t rest = size;
+    seed ^= hash_mix(seed ^ SECRET[0], SECRET[1]);
+    for (; rest > 16; rest -= 16, p += 16)
+    {
+        seed = hash_mix(read(p) ^ SECRET[1], read(p + 8) ^ seed);
+    }
+
+    // the last 0 to 16 bytes, padded with zeros
+    unsigned char tail[16] = {};
+    if (rest > 0)
+    {
+        std::memcpy(tail, p, rest);
+    }
+
+    return hash_mix(SECRET[0] ^ size, hash_mix(read(tail) ^ SECRET[1], read(tail + 8) ^ seed) ^ SECRET[2]);
+}
+
+// Memory resource used by allocators constructed in the current thread.
+inline thread_local std::pmr::memory_resource* current_resource = std::pmr::new_delete_resource();
+
+// Allocator that allocates from the memory resource of the current thread at the time it was constructed.
+// Unlike std::pmr::polymorphic_allocator, a copied container is bound to the current resource,
+// and assignment never makes a container use the memory of another resource.
+// In constant evaluation, it allocates by std::allocator, so containers can be used in constexpr functions.
+template <typename T>
+class Allocator
+{
+private:
+    // Memory resource, null if constructed in constant evaluation.
+    std::pmr::memory_resource* resource_;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+
+    constexpr Allocator()
+        : resource_(nullptr)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            resource_ = current_resource;
+        }
+    }
+
+    template <typename U>
+    constexpr Allocator(const Allocator<U>& that)
+        : resource_(that.resource_)
+    {
+    }
+
+    constexpr T* allocate(std::size_t n)
+    {
+        if (std::is_constant_evaluated())
+        {
+            return std::allocator<T>().allocate(n);
+        }
+        return static_cast<T*>(resource()->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    constexpr void deallocate(T* p, std::size_t n)
+    {
+        if (std::is_constant_evaluated())
+        {
+            return std::allocator<T>().deallocate(p, n);
+        }
+        resource()->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    constexpr Allocator select_on_container_copy_construction() const
+    {
+        return Allocator();
+    }
+
+    // An empty container constructed in constant evaluation (e.g. `constinit`) allocates by new and delete at run time.
+    std::pmr::memory_resource* resource() const
+    {
+        return resource_ ? resource_ : std::pmr::new_delete_resource();
+    }
+
+    template <typename U>
+    constexpr bool operator==(const Allocator<U>& that) const
+    {
+        return std::is_constant_evaluated() || *resource() == *that.resource();
+    }
+
+    template <typename U>
+    friend class Allocator;
+};
+
+// Print helper for Pair.
+// This function can only be placed here because of the header file reference order.
+template <typename K, typename V>
+std::ostream& operator<<(std::ostream& os, const std::pair<const K, V>& pair)
+{
+    return os << pair.first << ": " << pair.second;
+}
+
+// Print helper for range [`first`, `last`).
+template <std::input_iterator InputIt>
+static inline std::ostream& print(std::ostream& os, const InputIt& first, const InputIt& last, char open, char close)
+{
+    // This form looks complex, but there is only one judgment in the loop.
+    // At the Assembly level (see https://godbolt.org/z/qT9n7GKf8), this is more efficient
+    // than the usual short form of the generated machine code under O3-level optimization.
+    // The inspiration comes from Java source code.
+
+    if (first == last)
+    {
+        return os << open << close;
+    }
+
+    os << open;
+    auto it = first;
+    while (true)
+    {
+        os << *it++;
+        if (it == last)
+        {
+            return os << close;
+        }
+        os << ", ";
+    }
+}
+
+// Get the GCD of numbers for generics.
+template <typename T>
+static inline constexpr T gcd(T a, T b)
+{
+    // using Euclidean algorithm
+
+    a = a.abs();
+    b = b.abs();
+
+    while (b != 0) // a, b = b, a % b until b == 0
+    {
+        auto t = b;
+        b = a % b;
+        a = t;
+    }
+
+    return a; // a is the GCD
+}
+
+// Get the closest fraction to num/den (den > 0) with denominator <= max_den (>= 1) for integers of generics.
+// Walk the continued fraction until the next convergent is too large, then the answer is the last convergent
+// or the largest semiconvergent below the bound, whichever is closer. Same as Python's Fraction.limit_denominator.
+template <typename T>
+static inline std::pair<T, T> limit_denominator(const T& num, const T& den, const T& max_den)
+{
+    if (den <= max_den)
+    {
+        return {num, den};
+    }
+
+    T p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    T n = num, d = den;
+    while (true)
+    {
+        T a = n / d;
+        if (a * d > n) // floor division for negative n
+        {
+            a = a - 1;
+        }
+
+        T q2 = q0 + a * q1;
+        if (q2 > max_den)
+        {
+            break;
+        }
+
+        T p2 = p0 + a * p1;
+        p0 = std::move(p1);
+        q0 = std::move(q1);
+        p1 = std::move(p2);
+        q1 = std::move(q2);
+
+        T r = n - a * d;
+        n = std::move(d);
+        d = std::move(r);
+    }
+
+    // the semiconvergent (p0 + k*p1)/(q0 + k*q1) is farther iff 2*d*(q0 + k*q1) <= den
+    const T k = (max_den - q0) / q1;
+    const T q = q0 + k * q1;
+    if (d * q <= den / 2)
+    {
+        return {p1, q1};
+    }
+    return {p0 + k * p1, q};
+}
+
+} // namespace pyincpp::detail
+
+#endif // DETAIL_HPP
@@ -0,0 +1,369 @@
+//! @file fft.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief FFT class.
+//! @date 2026.10.17
+
+#ifndef FFT_HPP
+#define FFT_HPP
+
+#include "complex_array.hpp"
+
+#include <map>
+#include <numbers>
+
+namespace pyincpp
+{
+
+/// FFT provides the fast Fourier transform of complex sequences, normalized like numpy:
+/// the forward transform is unscaled and the inverse transform divides by the size.
+/// A plan holds the precomputed twiddles of one size and is cached for reuse by the current thread.
+/// Power-of-two sizes run radix-4 butterflies (with one radix-2 stage for odd powers),
+/// other sizes go through Bluestein's algorithm on a power-of-two transform.
+class FFT
+{
+private:
+    // Size of the transform.
+    int size_;
+
+    // Twiddles of the power-of-two transform, twiddle[L/2 + j] = exp(-2πij/L) for each stage of block size L,
+    // so each stage reads its twiddles contiguously.
+    std::vector<double> twiddle_re_;
+    std::vector<double> twiddle_im_;
+
+    // Bit reversal permutation of the power-of-two transform.
+    std::vector<int> reverse_;
+
+    // exp(-πik/size) for k < size, used to split the real transform of twice the size.
+    std::vector<double> half_re_;
+    std::vector<double> half_im_;
+
+    // Chirp exp(-πik²/size) of Bluestein's algorithm.
+    std::vector<double> chirp_re_;
+    std::vector<double> chirp_im_;
+
+    // Transform of the conjugate chirp filter of Bluestein's algorithm, divided by the inner size.
+    std::vector<double> filter_re_;
+    std::vector<double> filter_im_;
+
+    // Power-of-two plan of Bluestein's algorithm, null if the size is a power of two.
+    const FFT* inner_ = nullptr;
+
+    // Create a plan of `size`.
+    explicit FFT(int size)
+        : size_(size)
+        , half_re_(size)
+        , half_im_(size)
+    {
+        for (int k = 0; k < size; ++k)
+        {
+            half_re_[k] = std::cos(std::numbers::pi * k / size);
+            half_im_[k] = -std::sin(std::numbers::pi * k / size);
+        }
+
+        if (std::has_single_bit((unsigned)size))
+        {
+            twiddle_re_.resize(size);
+            twiddle_im_.resize(size);
+            for (int length = 2; length <= size; length *= 2)
+            {
+                for (int j = 0; j < length / 2; ++j)
+                {
+                    twiddle_re_[length / 2 + j] = std::cos(2 * std::numbers::pi * j / length);
+                    twiddle_im_[length / 2 + j] = -std::sin(2 * std::numbers::pi * j / length);
+                }
+            }
+
+            reverse_.resize(size);
+            for (int i = 1; i < size; ++i)
+            {
+                reverse_[i] = (reverse_[i >> 1] >> 1) | (i & 1 ? size >> 1 : 0);
+            }
+            return;
+        }
+
+        // a chirp-z convolution of length >= 2 * size - 1
+        inner_ = &plan(std::bit_ceil(2u * size - 1));
+        const int m = inner_->size_;
+
+        chirp_re_.resize(size);
+        chirp_im_.resize(size);
+        for (long long k = 0; k < size; ++k)
+        {
+            const double angle = std::numbers::pi * (k * k % (2 * size)) / size; // reduce k² for accuracy
+            chirp_re_[k] = std::cos(angle);
+            chirp_im_[k] = -std::sin(angle);
+        }
+
+        filter_re_.assign(m, 0);
+        filter_im_.assign(m, 0);
+        for (int k = 0; k < size; ++k)
+        {
+            filter_re_[k] = chirp_re_[k] / m;
+            filter_im_[k] = -chirp_im_[k] / m;
+            if (k > 0)
+            {
+                filter_re_[m - k] = filter_re_[k];
+                filter_im_[m - k] = filter_im_[k];
+            }
+        }
+        inner_->radix(filter_re_.data(), filter_im_.data());
+    }
+
+    // Transform in place by bit reversal and radix-4 butterflies, require the size is a power of two.
+    void radix(double* re, double* im) const
+    {
+        const int n = size_;
+        for (int i = 0; i < n; ++i)
+        {
+            if (int j = reverse_[i]; i < j)
+            {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+
+        int h = 1; // blocks of size h are transformed
+        if (std::countr_zero((unsigned)n) % 2 == 1)
+        {
+            for (int i = 0; i < n; i += 2)
+            {
+                const double r = re[i + 1], m = im[i + 1];
+                re[i + 1] = re[i] - r;
+                im[i + 1] = im[i] - m;
+                re[i] += r;
+                im[i] += m;
+            }
+            h = 2;
+        }
+
+        // two radix-2 stages in one pass: W1 = exp(-2πij/2h) of the inner stage, W2 = exp(-2πij/4h) of the outer stage,
+        // and the outer twiddle of the second half is W2 * exp(-πi/2) = -i * W2
+        for (; h < n; h *= 4)
+        {
+            const double* w1_re = &twiddle_re_[h];
+            const double* w1_im = &twiddle_im_[h];
+            const double* w2_re = &twiddle_re_[2 * h];
+            const double* w2_im = &twiddle_im_[2 * h];
+            for (int s = 0; s < n; s += 4 * h)
+            {
+                double* r0 = re + s;
+                double* r1 = r0 + h;
+                double* r2 = r1 + h;
+                double* r3 = r2 + h;
+                double* i0 = im + s;
+                double* i1 = i0 + h;
+                double* i2 = i1 + h;
+                double* i3 = i2 + h;
+                for (int j = 0; j < h; ++j)
+                {
+                    // inner stage
+                    const double t1_re = r1[j] * w1_re[j] - i1[j] * w1_im[j];
+                    const double t1_im = r1[j] * w1_im[j] + i1[j] * w1_re[j];
+                    const double t3_re = r3[j] * w1_re[j] - i3[j] * w1_im[j];
+                    const double t3_im = r3[j] * w1_im[j] + i3[j] * w1_re[j];
+                    const double y0_re = r0[j] + t1_re, y0_im = i0[j] + t1_im;
+                    const double y1_re = r0[j] - t1_re, y1_im = i0[j] - t1_im;
+                    const double y2_re = r2[j] + t3_re, y2_im = i2[j] + t3_im;
+                    const double y3_re = r2[j] - t3_re, y3_im = i2[j] - t3_im;
+
+                    // outer stage
+                    const double u2_re = y2_re * w2_re[j] - y2_im * w2_im[j];
+                    const double u2_im = y2_re * w2_im[j] + y2_im * w2_re[j];
+                    const double u3_re = y3_re * w2_im[j] + y3_im * w2_re[j]; // -i * W2 * y3
+                    const double u3_im = y3_im * w2_im[j] - y3_re * w2_re[j];
+                    r0[j] = y0_re + u2_re;
+                    i0[j] = y0_im + u2_im;
+                    r2[j] = y0_re - u2_re;
+                    i2[j] = y0_im - u2_im;
+                    r1[j] = y1_re + u3_re;
+                    i1[j] = y1_im + u3_im;
+                    r3[j] = y1_re - u3_re;
+                    i3[j] = y1_im - u3_im;
+                }
+            }
+        }
+    }
+
+    // Transform in place by Bluestein's algorithm, require the size is not a power of two.
+    void bluestein(double* re, double* im) const
+    {
+        const int m = inner_->size_;
+        std::vector<double> a_re(m), a_im(m);
+        for (int k = 0; k < size_; ++k)
+        {
+            a_re[k] = re[k] * chirp_re_[k] - im[k] * chirp_im_[k];
+            a_im[k] = re[k] * chirp_im_[k] + im[k] * chirp_re_[k];
+        }
+
+        // convolve with the filter: the inverse transform is the conjugate of the transform of the conjugate
+        inner_->radix(a_re.data(), a_im.data());
+        for (int k = 0; k < m; ++k)
+        {
+            const double r = a_re[k] * filter_re_[k] - a_im[k] * filter_im_[k];
+            const double i = a_re[k] * filter_im_[k] + a_im[k] * filter_re_[k];
+            a_re[k] = r;
+            a_im[k] = -i;
+        }
+        inner_->radix(a_re.data(), a_im.data());
+
+        for (int k = 0; k < size_; ++k)
+        {
+            re[k] = a_re[k] * chirp_re_[k] + a_im[k] * chirp_im_[k];
+            im[k] = a_re[k] * chirp_im_[k] - a_im[k] * chirp_re_[k];
+        }
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Return the plan of `size`, created at the first call and cached for reuse by the current thread.
+    /// If `size` < 1, throw a `runtime_error`.
+    static const FFT& plan(int size)
+    {
+        if (size < 1)
+        {
+            throw std::runtime_error("Error: Require size >= 1 for plan(size).");
+        }
+
+        static thread_local std::map<int, FFT> plans; // map, references are stable when growing
+
+        auto it = plans.find(size);
+        if (it == plans.end())
+        {
+            FFT fft(size); // a Bluestein plan creates its inner plan first
+            it = plans.emplace(size, std::move(fft)).first;
+        }
+
+        return it->second;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the size of the transform.
+    int size() const
+    {
+        return size_;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Transform the `array` of the plan size in place.
+    void forward(ComplexArray& array) const
+    {
+        if (array.size() != size_)
+        {
+            throw std::runtime_error("Error: The sizes of the array and the plan are different.");
+        }
+
+        if (inner_)
+        {
+            bluestein(array.real().data(), array.imag().data());
+        }
+        else
+        {
+            radix(array.real().data(), array.imag().data());
+        }
+    }
+
+    /// Inverse transform the `array` of the plan size in place.
+    void inverse(ComplexArray& array) const
+    {
+        // the inverse transform is the conjugate of the transform of the conjugate, divided by the size
+        auto imag = array.imag();
+        for (auto& x : imag)
+        {
+            x = -x;
+        }
+        forward(array);
+        for (auto& x : array.real())
+        {
+            x /= size_;
+        }
+        for (auto& x : imag)
+        {
+            x /= -size_;
+        }
+    }
+
+    /*
+     * Static
+     */
+
+    /// Transform the `array` in place by the cached plan of its size.
+    static void fft(ComplexArray& array)
+    {
+        plan(array.size()).forward(array);
+    }
+
+    /// Inverse transform the `array` in place by the cached plan of its size.
+    static void ifft(ComplexArray& array)
+    {
+        plan(array.size()).inverse(array);
+    }
+
+    /// Return the transform of the `list`.
+    static List<Complex> fft(const List<Complex>& list)
+    {
+        ComplexArray array(list);
+        fft(array);
+        return array.to_list();
+    }
+
+    /// Return the inverse transform of the `list`.
+    static List<Complex> ifft(const List<Complex>& list)
+    {
+        ComplexArray array(list);
+        ifft(array);
+        return array.to_list();
+    }
+
+    /// Return the transform of the real `list` of size n, the n/2 + 1 non-negative frequency terms like numpy.rfft.
+    /// An even size packs the even and odd samples into a complex transform of half the size.
+    static List<Complex> rfft(const List<double>& list)
+    {
+        const int n = list.size();
+        if (n % 2 == 1)
+        {
+            ComplexArray array(list, List<double>(std::vector<double>(n)));
+            fft(array);
+            List<Complex> result = array.to_list();
+            return result.slice(0, n / 2 + 1);
+        }
+
+        const int h = n / 2;
+        const FFT& half = plan(h);
+        ComplexArray z(h);
+        for (int k = 0; k < h; ++k)
+        {
+            z.real()[k] = list[2 * k];
+            z.imag()[k] = list[2 * k + 1];
+        }
+        half.forward(z);
+
+        // X[k] = E[k] + exp(-2πik/n) * O[k], E[k] = (Z[k] + conj(Z[h-k])) / 2, O[k] = (Z[k] - conj(Z[h-k])) / 2i
+        std::vector<Complex> result(h + 1);
+        const auto re = std::as_const(z).real();
+        const auto im = std::as_const(z).imag();
+        result[0] = Complex(re[0] + im[0]);
+        result[h] = Complex(re[0] - im[0]);
+        for (int k = 1; k < h; ++k)
+        {
+            const double e_re = (re[k] + re[h - k]) / 2, e_im = (im[k] - im[h - k]) / 2;
+            const double o_re = (im[k] + im[h - k]) / 2, o_im = (re[h - k] - re[k]) / 2;
+            const double w_re = half.half_re_[k], w_im = half.half_im_[k];
+            result[k] = Complex(e_re + w_re * o_re - w_im * o_im, e_im + w_re * o_im + w_im * o_re);
+        }
+
+        return List<Complex>(std::move(result));
+    }
+};
+
+} // namespace pyincpp
+
+#endif // FFT_HPP
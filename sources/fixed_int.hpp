@@ -0,0 +1,882 @@
+//! @file fixed_int.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief FixedInt class template.
+//! @date 2026.10.17
+
+#ifndef FIXED_INT_HPP
+#define FIXED_INT_HPP
+
+#include "int.hpp"
+
+namespace pyincpp
+{
+
+/// FixedInt provides support for fixed-width integer arithmetic, stored in place and usable in constant expressions.
+/// Values are in two's complement and wrap around on overflow, like the primitive integer types.
+/// @tparam Bits the number of bits: 128, 256, 512, etc. (a multiple of 32, at least 64)
+template <int Bits>
+    requires(Bits >= 64 && Bits % 32 == 0)
+class FixedInt
+{
+private:
+    // Number of 32-bit limbs.
+    static constexpr int N = Bits / 32;
+
+    // Array of limbs.
+    using Limbs = std::array<std::uint32_t, N>;
+
+    // Limbs of the integer in two's complement, little endian.
+    // Example: `-2` in FixedInt<64>
+    // ```
+    // limb:  0xfffffffe 0xffffffff
+    // index: 0          1
+    // ```
+    Limbs limbs_;
+
+    // Return the absolute value of the integer as unsigned limbs.
+    constexpr Limbs magnitude() const
+    {
+        return is_negative() ? (-*this).limbs_ : limbs_;
+    }
+
+    // Return the number of significant limbs in the first `n` limbs of `a`.
+    static constexpr int limbs_size(const std::uint32_t* a, int n)
+    {
+        while (n > 0 && a[n - 1] == 0)
+        {
+            --n;
+        }
+        return n;
+    }
+
+    // Return the number of significant bits of the unsigned limbs.
+    static constexpr int bit_width(const Limbs& a)
+    {
+        const int n = limbs_size(a.data(), N);
+        return n == 0 ? 0 : (n - 1) * 32 + std::bit_width(a[n - 1]);
+    }
+
+    // a = a * m + add, return the carry.
+    static constexpr std::uint32_t small_mul_add(Limbs& a, std::uint32_t m, std::uint32_t add)
+    {
+        std::uint64_t carry = add;
+        for (auto& limb : a)
+        {
+            carry += std::uint64_t(limb) * m;
+            limb = std::uint32_t(carry);
+            carry >>= 32;
+        }
+        return std::uint32_t(carry);
+    }
+
+    // a = a / d, return the remainder, `a` is unsigned.
+    static constexpr std::uint32_t small_div(Limbs& a, std::uint32_t d)
+    {
+        std::uint64_t r = 0;
+        for (int i = N - 1; i >= 0; --i)
+        {
+            r = (r << 32) | a[i];
+            a[i] = std::uint32_t(r / d);
+            r %= d;
+        }
+        return std::uint32_t(r);
+    }
+
+    // Divide the unsigned `m`-limb `u` by the unsigned `n`-limb `v` (`v[n - 1] != 0`) in O(M*N) by Knuth's algorithm D.
+    // Store the quotient in `q` (`m` limbs, zero initialized) and the remainder in `r` (`n` limbs).
+    static constexpr void divmod_limbs(const std::uint32_t* u, int m, const std::uint32_t* v, int n, std::uint32_t* q, std::uint32_t* r)
+    {
+        if (m < n)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                r[i] = i < m ? u[i] : 0;
+            }
+            return;
+        }
+
+        if (n == 1)
+        {
+            std::uint64_t k = 0;
+            for (int j = m - 1; j >= 0; --j)
+            {
+                k = (k << 32) | u[j];
+                q[j] = std::uint32_t(k / v[0]);
+                k %= v[0];
+            }
+            r[0] = std::uint32_t(k);
+            return;
+        }
+
+        // normalize so that the top limb of the divisor has its highest bit set
+        const int s = std::countl_zero(v[n - 1]);
+        std::array<std::uint32_t, N * 2 + 1> un{}, vn{};
+        for (int i = n - 1; i > 0; --i)
+        {
+            vn[i] = std::uint32_t((std::uint64_t(v[i]) << s) | (std::uint64_t(v[i - 1]) >> (32 - s)));
+        }
+        vn[0] = v[0] << s;
+        un[m] = std::uint32_t(std::uint64_t(u[m - 1]) >> (32 - s));
+        for (int i = m - 1; i > 0; --i)
+        {
+            un[i] = std::uint32_t((std::uint64_t(u[i]) << s) | (std::uint64_t(u[i - 1]) >> (32 - s)));
+        }
+        un[0] = u[0] << s;
+
+        constexpr std::uint64_t B = std::uint64_t(1) << 32;
+        for (int j = m - n; j >= 0; --j)
+        {
+            // estimate the quotient limb, too large by at most 2
+            const std::uint64_t num = (std::uint64_t(un[j + n]) << 32) | un[j + n - 1];
+            std::uint64_t qhat = num / vn[n - 1];
+            std::uint64_t rhat = num % vn[n - 1];
+            while (qhat >= B || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2]))
+            {
+                --qhat;
+                rhat += vn[n - 1];
+                if (rhat >= B)
+                {
+                    break;
+                }
+            }
+
+            // multiply and subtract
+            std::int64_t k = 0, t = 0;
+            for (int i = 0; i < n; ++i)
+            {
+                const std::uint64_t p = qhat * vn[i];
+                t = std::int64_t(un[i + j]) - k - std::int64_t(p & 0xffffffff);
+                un[i + j] = std::uint32_t(t);
+                k = std::int64_t(p >> 32) - (t >> 32);
+            }
+            t = std::int64_t(un[j + n]) - k;
+            un[j + n] = std::uint32_t(t);
+
+            // add back if the estimate was one too large
+            q[j] = std::uint32_t(qhat);
+            if (t < 0)
+            {
+                --q[j];
+                std::uint64_t carry = 0;
+                for (int i = 0; i < n; ++i)
+                {
+                    carry += std::uint64_t(un[i + j]) + vn[i];
+                    un[i + j] = std::uint32_t(carry);
+                    carry >>= 32;
+                }
+                un[j + n] += std::uint32_t(carry);
+            }
+        }
+
+        // unnormalize the remainder
+        for (int i = 0; i < n; ++i)
+        {
+            r[i] = std::uint32_t((std::uint64_t(un[i]) >> s) | (std::uint64_t(un[i + 1]) << (32 - s)));
+        }
+    }
+
+    // Return `(a * b) % m` without overflow, the remainder has the sign of `a * b`.
+    static constexpr FixedInt mul_mod(const FixedInt& a, const FixedInt& b, const FixedInt& m)
+    {
+        const Limbs x = a.magnitude(), y = b.magnitude(), z = m.magnitude();
+
+        // full product
+        std::array<std::uint32_t, N * 2> p{};
+        for (int i = 0; i < N; ++i)
+        {
+            std::uint64_t carry = 0;
+            for (int j = 0; j < N; ++j)
+            {
+                carry += std::uint64_t(x[i]) * y[j] + p[i + j];
+                p[i + j] = std::uint32_t(carry);
+                carry >>= 32;
+            }
+            p[i + N] = std::uint32_t(carry);
+        }
+
+        std::array<std::uint32_t, N * 2> q{};
+        FixedInt r;
+        divmod_limbs(p.data(), limbs_size(p.data(), N * 2), z.data(), limbs_size(z.data(), N), q.data(), r.limbs_.data());
+        return a.is_negative() != b.is_negative() ? -r : r;
+    }
+
+    // Determine whether odd `n` > 2 is a strong probable prime to `base`.
+    static constexpr bool is_strong_probable_prime(const FixedInt& n, const FixedInt& base)
+    {
+        FixedInt d = n - 1;
+        int s = 0;
+        while (d.is_even())
+        {
+            d >>= 1;
+            ++s;
+        }
+
+        FixedInt x = pow(base, d, n);
+        if (x == 1 || x == n - 1)
+        {
+            return true;
+        }
+        for (int i = 1; i < s; ++i)
+        {
+            x = mul_mod(x, x, n);
+            if (x == n - 1)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an integer based on the given integer `n` (default = 0).
+    /// @tparam T a primitive integer type: int (default), long, etc.
+    template <std::integral T = int>
+    constexpr FixedInt(T n = 0)
+        : limbs_{}
+    {
+        const std::uint64_t u = std::uint64_t(n); // sign extended if negative
+        limbs_[0] = std::uint32_t(u);
+        limbs_[1] = std::uint32_t(u >> 32);
+        const std::uint32_t fill = std::is_signed_v<T> && n < 0 ? 0xffffffff : 0;
+        for (int i = 2; i < N; ++i)
+        {
+            limbs_[i] = fill;
+        }
+    }
+
+    /// Create an integer based on the given null-terminated decimal characters, overflow wraps around.
+    constexpr FixedInt(const char* chars)
+        : limbs_{}
+    {
+        const int len = std::char_traits<char>::length(chars);
+        const int start = len > 0 && (chars[0] == '+' || chars[0] == '-');
+        if (start == len || !std::all_of(chars + start, chars + len, [](char ch)
+                                         { return ch >= '0' && ch <= '9'; }))
+        {
+            throw std::runtime_error("Error: Wrong integer literal.");
+        }
+
+        // 9 digits at a time
+        for (int i = start; i < len; i += 9)
+        {
+            std::uint32_t chunk = 0, scale = 1;
+            for (int j = i; j < len && j < i + 9; ++j)
+            {
+                chunk = chunk * 10 + (chars[j] - '0');
+                scale *= 10;
+            }
+            small_mul_add(limbs_, scale, chunk);
+        }
+
+        if (chars[0] == '-')
+        {
+            *this = -*this;
+        }
+    }
+
+    /// Create an integer from an `Int`, keeping the low `Bits` bits like a narrowing conversion.
+    explicit FixedInt(const Int& n)
+        : limbs_{}
+    {
+        const Int modulus = Int::pow(2, Bits);
+        Int r = n % modulus;
+        if (r.is_negative())
+        {
+            r += modulus;
+        }
+
+        const auto bytes = r.to_bytes(Bits / 8, std::endian::little);
+        for (int i = 0; i < Bits / 8; ++i)
+        {
+            limbs_[i / 4] |= std::uint32_t(bytes[i]) << (i % 4 * 8);
+        }
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this integer is equal to another integer.
+    constexpr bool operator==(const FixedInt& that) const = default;
+
+    /// Compare the integer with another integer.
+    constexpr std::strong_ordering operator<=>(const FixedInt& that) const
+    {
+        // the top limb carries the sign
+        if (limbs_[N - 1] != that.limbs_[N - 1])
+        {
+            return std::int32_t(limbs_[N - 1]) <=> std::int32_t(that.limbs_[N - 1]);
+        }
+
+        for (int i = N - 2; i >= 0; --i)
+        {
+            if (limbs_[i] != that.limbs_[i])
+            {
+                return limbs_[i] <=> that.limbs_[i];
+            }
+        }
+
+        return std::strong_ordering::equal;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of digits in the integer (based 10).
+    constexpr int digits() const
+    {
+        Limbs a = magnitude();
+        int count = 0;
+        while (limbs_size(a.data(), N) > 0)
+        {
+            std::uint32_t r = small_div(a, 1'000'000'000);
+            if (limbs_size(a.data(), N) > 0)
+            {
+                count += 9;
+            }
+            else
+            {
+                for (; r > 0; r /= 10)
+                {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+
+    /// Determine whether the integer is zero quickly.
+    constexpr bool is_zero() const
+    {
+        return limbs_size(limbs_.data(), N) == 0;
+    }
+
+    /// Determine whether the integer is positive quickly.
+    constexpr bool is_positive() const
+    {
+        return !is_negative() && !is_zero();
+    }
+
+    /// Determine whether the integer is negative quickly.
+    constexpr bool is_negative() const
+    {
+        return (limbs_[N - 1] >> 31) == 1;
+    }
+
+    /// Determine whether the integer is even quickly.
+    constexpr bool is_even() const
+    {
+        return (limbs_[0] & 1) == 0;
+    }
+
+    /// Determine whether the integer is odd quickly.
+    constexpr bool is_odd() const
+    {
+        return (limbs_[0] & 1) == 1;
+    }
+
+    /// Determine whether the integer is prime number.
+    /// Use trial division by small primes and then the Miller-Rabin test with the first 12 prime bases,
+    /// which is deterministic below 3.3 * 10^24 and a strong probable prime test beyond.
+    constexpr bool is_prime() const
+    {
+        if (*this <= 1)
+        {
+            return false; // prime >= 2
+        }
+
+        constexpr int primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+        for (int p : primes)
+        {
+            if (*this == p)
+            {
+                return true;
+            }
+            if ((*this % p).is_zero())
+            {
+                return false;
+            }
+        }
+
+        return std::all_of(std::begin(primes), std::end(primes), [this](int p)
+                           { return is_strong_probable_prime(*this, p); });
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs`.
+    constexpr FixedInt& operator+=(const FixedInt& rhs)
+    {
+        std::uint64_t carry = 0;
+        for (int i = 0; i < N; ++i)
+        {
+            carry += std::uint64_t(limbs_[i]) + rhs.limbs_[i];
+            limbs_[i] = std::uint32_t(carry);
+            carry >>= 32;
+        }
+        return *this;
+    }
+
+    /// Return this -= `rhs`.
+    constexpr FixedInt& operator-=(const FixedInt& rhs)
+    {
+        std::uint64_t borrow = 0;
+        for (int i = 0; i < N; ++i)
+        {
+            const std::uint64_t diff = std::uint64_t(limbs_[i]) - rhs.limbs_[i] - borrow;
+            limbs_[i] = std::uint32_t(diff);
+            borrow = diff >> 63;
+        }
+        return *this;
+    }
+
+    /// Return this *= `rhs`.
+    constexpr FixedInt& operator*=(const FixedInt& rhs)
+    {
+        // the low half of the product is the same for signed and unsigned operands
+        Limbs result{};
+        for (int i = 0; i < N; ++i)
+        {
+            std::uint64_t carry = 0;
+            for (int j = 0; i + j < N; ++j)
+            {
+                carry += std::uint64_t(limbs_[i]) * rhs.limbs_[j] + result[i + j];
+                result[i + j] = std::uint32_t(carry);
+                carry >>= 32;
+            }
+        }
+        limbs_ = result;
+        return *this;
+    }
+
+    /// Return this /= `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr FixedInt& operator/=(const FixedInt& rhs)
+    {
+        return *this = divmod(rhs).first;
+    }
+
+    /// Return this %= `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr FixedInt& operator%=(const FixedInt& rhs)
+    {
+        return *this = divmod(rhs).second;
+    }
+
+    /// Return the quotient and remainder simultaneously.
+    /// `this == (this / rhs) * rhs + this % rhs`
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr std::pair<FixedInt, FixedInt> divmod(const FixedInt& rhs) const
+    {
+        if (rhs.is_zero())
+        {
+            throw std::runtime_error("Error: Divide by zero.");
+        }
+
+        const Limbs a = magnitude(), b = rhs.magnitude();
+        FixedInt q, r;
+        divmod_limbs(a.data(), limbs_size(a.data(), N), b.data(), limbs_size(b.data(), N), q.limbs_.data(), r.limbs_.data());
+
+        // q.sign = this.sign * rhs.sign, r.sign = this.sign
+        return {is_negative() != rhs.is_negative() ? -q : q, is_negative() ? -r : r};
+    }
+
+    /// Increase the value by 1 quickly.
+    constexpr FixedInt& operator++()
+    {
+        for (auto& limb : limbs_)
+        {
+            if (++limb != 0)
+            {
+                break;
+            }
+        }
+        return *this;
+    }
+
+    /// Decrease the value by 1 quickly.
+    constexpr FixedInt& operator--()
+    {
+        for (auto& limb : limbs_)
+        {
+            if (limb-- != 0)
+            {
+                break;
+            }
+        }
+        return *this;
+    }
+
+    /// Return this &= `rhs`.
+    constexpr FixedInt& operator&=(const FixedInt& rhs)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            limbs_[i] &= rhs.limbs_[i];
+        }
+        return *this;
+    }
+
+    /// Return this |= `rhs`.
+    constexpr FixedInt& operator|=(const FixedInt& rhs)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            limbs_[i] |= rhs.limbs_[i];
+        }
+        return *this;
+    }
+
+    /// Return this ^= `rhs`.
+    constexpr FixedInt& operator^=(const FixedInt& rhs)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            limbs_[i] ^= rhs.limbs_[i];
+        }
+        return *this;
+    }
+
+    /// Return this <<= `shift`, require 0 <= `shift` < `Bits`.
+    constexpr FixedInt& operator<<=(int shift)
+    {
+        const int limb_shift = shift / 32, bit_shift = shift % 32;
+        for (int i = N - 1; i >= 0; --i)
+        {
+            const std::uint64_t hi = i - limb_shift >= 0 ? limbs_[i - limb_shift] : 0;
+            const std::uint64_t lo = i - limb_shift - 1 >= 0 ? limbs_[i - limb_shift - 1] : 0;
+            limbs_[i] = std::uint32_t((hi << bit_shift) | (lo >> (32 - bit_shift)));
+        }
+        return *this;
+    }
+
+    /// Return this >>= `shift` (arithmetic shift), require 0 <= `shift` < `Bits`.
+    constexpr FixedInt& operator>>=(int shift)
+    {
+        const int limb_shift = shift / 32, bit_shift = shift % 32;
+        const std::uint64_t fill = is_negative() ? 0xffffffff : 0;
+        for (int i = 0; i < N; ++i)
+        {
+            const std::uint64_t lo = i + limb_shift < N ? limbs_[i + limb_shift] : fill;
+            const std::uint64_t hi = i + limb_shift + 1 < N ? limbs_[i + limb_shift + 1] : fill;
+            limbs_[i] = std::uint32_t((lo >> bit_shift) | (hi << (32 - bit_shift)));
+        }
+        return *this;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return a copy of this.
+    constexpr FixedInt operator+() const
+    {
+        return *this;
+    }
+
+    /// Return the opposite value of this, the minimum value stays the same.
+    constexpr FixedInt operator-() const
+    {
+        return ++~*this;
+    }
+
+    /// Return the bitwise complement of this.
+    constexpr FixedInt operator~() const
+    {
+        FixedInt result = *this;
+        for (auto& limb : result.limbs_)
+        {
+            limb = ~limb;
+        }
+        return result;
+    }
+
+    /// Return the absolute value of this.
+    constexpr FixedInt abs() const
+    {
+        return is_negative() ? -*this : *this;
+    }
+
+    /// Return this + `rhs`.
+    constexpr FixedInt operator+(const FixedInt& rhs) const
+    {
+        return FixedInt(*this) += rhs;
+    }
+
+    /// Return this - `rhs`.
+    constexpr FixedInt operator-(const FixedInt& rhs) const
+    {
+        return FixedInt(*this) -= rhs;
+    }
+
+    /// Return this * `rhs`.
+    constexpr FixedInt operator*(const FixedInt& rhs) const
+    {
+        return FixedInt(*this) *= rhs;
+    }
+
+    /// Return this / `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr FixedInt operator/(const FixedInt& rhs) const
+    {
+        return divmod(rhs).first;
+    }
+
+    /// Return this % `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr FixedInt operator%(const FixedInt& rhs) const
+    {
+        return divmod(rhs).second;
+    }
+
+    /// Return this & `rhs`.
+    constexpr FixedInt operator&(const FixedInt& rhs) const
+    {
+        return FixedInt(*this) &= rhs;
+    }
+
+    /// Return this | `rhs`.
+    constexpr FixedInt operator|(const FixedInt& rhs) const
+    {
+        return FixedInt(*this) |= rhs;
+    }
+
+    /// Return this ^ `rhs`.
+    constexpr FixedInt operator^(const FixedInt& rhs) const
+    {
+        return FixedInt(*this) ^= rhs;
+    }
+
+    /// Return this << `shift`, require 0 <= `shift` < `Bits`.
+    constexpr FixedInt operator<<(int shift) const
+    {
+        return FixedInt(*this) <<= shift;
+    }
+
+    /// Return this >> `shift` (arithmetic shift), require 0 <= `shift` < `Bits`.
+    constexpr FixedInt operator>>(int shift) const
+    {
+        return FixedInt(*this) >>= shift;
+    }
+
+    /// Convert the integer to an `Int`.
+    explicit operator Int() const
+    {
+        std::vector<unsigned char> bytes(Bits / 8);
+        for (int i = 0; i < Bits / 8; ++i)
+        {
+            bytes[i] = limbs_[i / 4] >> (i % 4 * 8);
+        }
+        return Int::from_bytes(bytes, std::endian::little, true);
+    }
+
+    /// Attempt to convert this integer to a number of the specified type `T`.
+    /// @tparam T a numeric type: int (default), long, double, etc.
+    template <typename T = int>
+    constexpr T to_number() const
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            return T((std::uint64_t(limbs_[1]) << 32) | limbs_[0]); // keep the low bits
+        }
+        else
+        {
+            T result = 0;
+            for (const auto& limb : magnitude() | std::views::reverse)
+            {
+                result = result * 4294967296.0 + limb;
+            }
+            return is_negative() ? -result : result;
+        }
+    }
+
+    /// Convert the integer to a string in the given `base` (default = 10), like `Int::to_string()`.
+    std::string to_string(int base = 10) const
+    {
+        if (base < 2 || base > 36)
+        {
+            throw std::runtime_error("Error: Invalid base for to_string().");
+        }
+
+        // the largest power of base that fits in a limb
+        std::uint32_t big_base = base;
+        int width = 1;
+        while (std::uint64_t(big_base) * base <= 0xffffffff)
+        {
+            big_base *= base;
+            ++width;
+        }
+
+        std::string str;
+        Limbs a = magnitude();
+        do
+        {
+            std::uint32_t r = small_div(a, big_base);
+            const bool last = limbs_size(a.data(), N) == 0;
+            for (int i = 0; i < width && (!last || r > 0); ++i)
+            {
+                str += "0123456789abcdefghijklmnopqrstuvwxyz"[r % base];
+                r /= base;
+            }
+        } while (limbs_size(a.data(), N) > 0);
+
+        if (str.empty())
+        {
+            str = "0";
+        }
+        if (is_negative())
+        {
+            str += '-';
+        }
+        std::reverse(str.begin(), str.end());
+
+        return str;
+    }
+
+    /*
+     * Static
+     */
+
+    /// Return the maximum value of the type.
+    static constexpr FixedInt max()
+    {
+        return ~min();
+    }
+
+    /// Return the minimum value of the type.
+    static constexpr FixedInt min()
+    {
+        return FixedInt(1) << (Bits - 1);
+    }
+
+    /// Return the square root of integer `n`.
+    static constexpr FixedInt sqrt(const FixedInt& n)
+    {
+        if (n.is_negative())
+        {
+            throw std::runtime_error("Error: Require n >= 0 for sqrt(n).");
+        }
+
+        if (n.is_zero())
+        {
+            return 0;
+        }
+
+        // Newton's method from above
+        FixedInt x = FixedInt(1) << ((bit_width(n.limbs_) + 1) / 2);
+        while (true)
+        {
+            FixedInt y = (x + n / x) >> 1;
+            if (y >= x)
+            {
+                return x;
+            }
+            x = y;
+        }
+    }
+
+    /// Return `(base**exp) % mod` (`mod` default = 0 means does not perform module).
+    /// With a module, the intermediate products are computed in double width, so they never overflow.
+    static constexpr FixedInt pow(const FixedInt& base, const FixedInt& exp, const FixedInt& mod = 0)
+    {
+        // if base.abs is 1, only when base is negative and exp is odd return -1, otherwise return 1
+        if (base == 1 || base == -1)
+        {
+            return base.is_negative() && exp.is_odd() ? -1 : 1;
+        }
+
+        // then, check if exp is negative
+        if (exp.is_negative())
+        {
+            if (base.is_zero())
+            {
+                throw std::runtime_error("Error: Math domain error.");
+            }
+
+            return 0;
+        }
+
+        // fast power algorithm
+        FixedInt num = base, n = exp, res = 1;
+        while (!n.is_zero())
+        {
+            if (n.is_odd())
+            {
+                res = mod.is_zero() ? res * num : mul_mod(res, num, mod);
+            }
+            num = mod.is_zero() ? num * num : mul_mod(num, num, mod);
+            n >>= 1;
+        }
+
+        return res;
+    }
+
+    /// Calculate the greatest common divisor of two integers.
+    static constexpr FixedInt gcd(FixedInt a, FixedInt b)
+    {
+        // using Euclidean algorithm
+
+        a = a.abs();
+        b = b.abs();
+
+        while (!b.is_zero()) // a, b = b, a % b until b == 0
+        {
+            a = std::exchange(b, a % b);
+        }
+
+        return a; // a is the GCD
+    }
+
+    /// Calculate the least common multiple of two integers.
+    static constexpr FixedInt lcm(const FixedInt& a, const FixedInt& b)
+    {
+        if (a.is_zero() || b.is_zero())
+        {
+            return 0;
+        }
+
+        return (a / gcd(a, b) * b).abs(); // LCM = |a / GCD * b|
+    }
+
+    /*
+     * Print / Input
+     */
+
+    /// Output the integer to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const FixedInt& integer)
+    {
+        return os << integer.to_string();
+    }
+
+    /// Get an integer from the specified input stream.
+    friend std::istream& operator>>(std::istream& is, FixedInt& integer)
+    {
+        std::string str;
+        is >> str;
+        integer = str.c_str();
+
+        return is;
+    }
+
+    friend struct std::hash<pyincpp::FixedInt<Bits>>;
+};
+
+} // namespace pyincpp
+
+template <int Bits>
+struct std::hash<pyincpp::FixedInt<Bits>> // partial specialization
+{
+    std::size_t operator()(const pyincpp::FixedInt<Bits>& integer) const
+    {
+        return pyincpp::detail::hash_bytes(integer.limbs_.data(), sizeof(integer.limbs_));
+    }
+};
+
+#endif // FIXED_INT_HPP
@@ -1,326 +1,524 @@
-//! @file fraction.hpp
-//! @author Chen QingYu <chen_qingyu@qq.com>
-//! @brief Fraction class.
-//! @date 2024.01.15
-
-#ifndef FRACTION_HPP
-#define FRACTION_HPP
-
-#include "detail.hpp"
-
-namespace pyincpp
-{
-
-/// Fraction provides support for rational number arithmetic.
-class Fraction
-{
-private:
-    // Numerator.
-    int num_;
-
-    // Denominator.
-    int den_;
-
-public:
-    /*
-     * Constructor
-     */
-
-    /// Create a fraction with value `numerator/denominator`.
-    Fraction(int numerator = 0, int denominator = 1)
-        : num_(numerator)
-        , den_(denominator)
-    {
-        // make sure the denominator is not zero
-        detail::check_zero(den_);
-
-        // make sure the denominator is a positive number
-        if (den_ < 0)
-        {
-            num_ = -num_;
-            den_ = -den_;
-        }
-
-        // simplify
-        int gcd = std::gcd(num_, den_);
-        num_ /= gcd;
-        den_ /= gcd;
-    }
-
-    /// Create a fraction with given double-precision floating-point `number`.
-    Fraction(double number)
-    {
-        double int_part = std::floor(number);
-        double dec_part = number - int_part;
-        int precision = 1'000'000'000; // 10^floor(log10(INT_MAX))
-
-        int gcd = std::gcd(int(std::round(dec_part * precision)), precision);
-        num_ = std::round(dec_part * precision) / gcd;
-        den_ = precision / gcd;
-        num_ += int_part * den_;
-    }
-
-    /// Copy constructor.
-    Fraction(const Fraction& that) = default;
-
-    /// Move constructor.
-    Fraction(Fraction&& that)
-        : num_(std::move(that.num_))
-        , den_(std::move(that.den_))
-    {
-        that.num_ = 0;
-        that.den_ = 1;
-    }
-
-    /*
-     * Comparison
-     */
-
-    /// Compare the fraction with another fraction.
-    auto operator<=>(const Fraction& that) const
-    {
-        // this = a/b; that = c/d;
-        // so, this - that = a/b - c/d = (ad - bc)/(bd)
-        // since bd is always positive, compute (ad-bc) only
-        const int a = this->num_;
-        const int b = this->den_;
-        const int c = that.num_;
-        const int d = that.den_;
-
-        return a * d - b * c;
-    }
-
-    /*
-     * Assignment
-     */
-
-    /// Copy assignment operator.
-    Fraction& operator=(const Fraction& that) = default;
-
-    /// Move assignment operator.
-    Fraction& operator=(Fraction&& that)
-    {
-        num_ = std::move(that.num_);
-        den_ = std::move(that.den_);
-
-        that.num_ = 0;
-        that.den_ = 1;
-
-        return *this;
-    }
-
-    /*
-     * Examination
-     */
-
-    /// Convert the fraction to double type.
-    operator double() const
-    {
-        return double(num_) / double(den_);
-    }
-
-    /// Get the numerator of this.
-    int numerator() const
-    {
-        return num_;
-    }
-
-    /// Get the denominator of this.
-    int denominator() const
-    {
-        return den_;
-    }
-
-    /*
-     * Manipulation
-     */
-
-    /// Return this += `rhs`.
-    Fraction& operator+=(const Fraction& rhs)
-    {
-        return *this = *this + rhs;
-    }
-
-    /// Return this -= `rhs`.
-    Fraction& operator-=(const Fraction& rhs)
-    {
-        return *this = *this - rhs;
-    }
-
-    /// Return this *= `rhs`.
-    Fraction& operator*=(const Fraction& rhs)
-    {
-        return *this = *this * rhs;
-    }
-
-    /// Return this /= `rhs` (not zero).
-    Fraction& operator/=(const Fraction& rhs)
-    {
-        return *this = *this / rhs;
-    }
-
-    /// Return this %= `rhs` (not zero).
-    Fraction& operator%=(const Fraction& rhs)
-    {
-        return *this = *this % rhs;
-    }
-
-    /// Increment the value by 1.
-    Fraction& operator++()
-    {
-        num_ += den_;
-        return *this;
-    }
-
-    /// Decrement the value by 1.
-    Fraction& operator--()
-    {
-        num_ -= den_;
-        return *this;
-    }
-
-    /*
-     * Production
-     */
-
-    /// Return the copy of this.
-    Fraction operator+() const
-    {
-        return *this;
-    }
-
-    /// Return the opposite value of this.
-    Fraction operator-() const
-    {
-        return Fraction(-num_, den_);
-    }
-
-    /// Return the absolute value of this.
-    Fraction abs() const
-    {
-        return Fraction(std::abs(num_), den_);
-    }
-
-    /// Return this + `rhs`.
-    Fraction operator+(const Fraction& rhs) const
-    {
-        return Fraction(num_ * rhs.den_ + den_ * rhs.num_, den_ * rhs.den_);
-    }
-
-    /// Return this - `rhs`.
-    Fraction operator-(const Fraction& rhs) const
-    {
-        return Fraction(num_ * rhs.den_ - den_ * rhs.num_, den_ * rhs.den_);
-    }
-
-    /// Return this * `rhs`.
-    Fraction operator*(const Fraction& rhs) const
-    {
-        return Fraction(num_ * rhs.num_, den_ * rhs.den_);
-    }
-
-    /// Return this / `rhs` (not zero).
-    Fraction operator/(const Fraction& rhs) const
-    {
-        return Fraction(num_ * rhs.den_, den_ * rhs.num_);
-    }
-
-    /// Return this % `rhs` (not zero).
-    Fraction operator%(const Fraction& rhs) const
-    {
-        detail::check_zero(rhs);
-
-        return Fraction((num_ * rhs.den_) % (rhs.num_ * den_), den_ * rhs.den_);
-    }
-
-    /// Calculate the greatest common divisor of two fractions.
-    static Fraction gcd(const Fraction& a, const Fraction& b)
-    {
-        return detail::gcd(a, b);
-    }
-
-    /// Calculate the least common multiple of two fractions.
-    static Fraction lcm(const Fraction& a, const Fraction& b)
-    {
-        if (a == 0 || b == 0)
-        {
-            return 0;
-        }
-
-        return (a * b).abs() / gcd(a, b); // LCM = |a * b| / GCD
-    }
-
-    /*
-     * Print / Input
-     */
-
-    /// Output the fraction to the specified output stream.
-    friend std::ostream& operator<<(std::ostream& os, const Fraction& fraction)
-    {
-        if (fraction.den_ == 1)
-        {
-            return os << fraction.num_;
-        }
-        else
-        {
-            return os << fraction.num_ << "/" << fraction.den_;
-        }
-    }
-
-    /// Get a fraction from the specified input stream.
-    ///
-    /// ### Example
-    /// ```
-    /// Fraction f1, f2;
-    /// std::istringstream("+1/-2 233") >> f1 >> f2;
-    /// // f1 == Fraction(-1, 2);
-    /// // f2 == Fraction(233);
-    /// ```
-    friend std::istream& operator>>(std::istream& is, Fraction& fraction)
-    {
-        while (is.peek() <= 0x20)
-        {
-            is.ignore();
-        }
-        if (!(std::isdigit(is.peek()) || is.peek() == '-' || is.peek() == '+')) // handle "z1/2"
-        {
-            throw std::runtime_error("Error: Wrong fraction literal.");
-        }
-
-        int num;
-        is >> num;
-        if (is.peek() <= 0x20) // next char is white space, ok
-        {
-            fraction = num;
-            return is;
-        }
-
-        char c;
-        int den;
-        is >> c;
-        if (!(std::isdigit(is.peek()) || is.peek() == '-' || is.peek() == '+')) // handle "1z/2" or "1/z2"
-        {
-            throw std::runtime_error("Error: Wrong fraction literal.");
-        }
-        is >> den;
-        if (c != '/' || is.peek() > 0x20) // handle "1|2" or "1/2z"
-        {
-            throw std::runtime_error("Error: Wrong fraction literal.");
-        }
-        fraction = Fraction(num, den);
-        return is;
-    }
-};
-
-} // namespace pyincpp
-
-template <>
-struct std::hash<pyincpp::Fraction> // explicit specialization
-{
-    std::size_t operator()(const pyincpp::Fraction& fraction) const
-    {
-        return std::hash<int>{}(fraction.numerator()) ^ (std::hash<int>{}(fraction.denominator()) << 1);
-    }
-};
-
-#endif // FRACTION_HPP
+//! @file fraction.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Fraction class.
+//! @date 2024.01.15
+
+#ifndef FRACTION_HPP
+#define FRACTION_HPP
+
+#include "detail.hpp"
+
+#include "int.hpp"
+
+namespace pyincpp
+{
+
+/// Fraction provides support for rational number arithmetic.
+class Fraction
+{
+private:
+    // Numerator.
+    int num_;
+
+    // Denominator.
+    int den_;
+
+    // Add `num/den` (simplified) to this in place.
+    // With g = gcd(b, d), a/b + c/d = (a*(d/g) + c*(b/g)) / (b/g*d), and only g can share factors with the numerator,
+    // so the gcd is computed on the small values instead of the full products (Henrici).
+    Fraction& add(int num, int den)
+    {
+        const int g = std::gcd(den_, den);
+        const long long t = 1ll * num_ * (den / g) + 1ll * num * (den_ / g);
+        if (t == 0)
+        {
+            num_ = 0;
+            den_ = 1;
+            return *this;
+        }
+
+        const int g2 = std::gcd(t, (long long)g);
+        num_ = t / g2;
+        den_ = den_ / g * (den / g2);
+        return *this;
+    }
+
+    // Walk the convergents p/q of the continued fraction of n/d, return the first one that converts back to `number`,
+    // or the last one that fits in int.
+    template <typename T>
+    static std::pair<int, int> convergent(T n, T d, double number)
+    {
+        long long p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+        while (d != 0)
+        {
+            const T a = n / d;
+
+            // the next convergent is (p0 + a*p1)/(q0 + a*q1), it must fit in int
+            if ((p1 != 0 && a > T((INT_MAX - p0) / p1)) || (q1 != 0 && a > T((INT_MAX - q0) / q1)))
+            {
+                break;
+            }
+
+            long long a_ll;
+            if constexpr (std::is_same_v<T, Int>)
+            {
+                a_ll = a.template to_number<long long>();
+            }
+            else
+            {
+                a_ll = a;
+            }
+            p0 = std::exchange(p1, p0 + a_ll * p1);
+            q0 = std::exchange(q1, q0 + a_ll * q1);
+            if (double(p1) / double(q1) == number)
+            {
+                break;
+            }
+
+            T r = n - a * d;
+            n = std::move(d);
+            d = std::move(r);
+        }
+
+        return {int(p1), int(q1)};
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create a fraction with value `numerator/denominator`.
+    Fraction(int numerator = 0, int denominator = 1)
+        : num_(numerator)
+        , den_(denominator)
+    {
+        // make sure the denominator is not zero
+        detail::check_zero(den_);
+
+        // make sure the denominator is a positive number
+        if (den_ < 0)
+        {
+            num_ = -num_;
+            den_ = -den_;
+        }
+
+        // simplify
+        int gcd = std::gcd(num_, den_);
+        num_ /= gcd;
+        den_ /= gcd;
+    }
+
+    /// Create a fraction with given double-precision floating-point `number`.
+    /// It is the simplest convergent of the exact value of `number` that converts back to `number`,
+    /// or the closest convergent in int range, so `Fraction(0.1)` is 1/10.
+    /// If `number` is NaN, infinity or out of int range, throw a `runtime_error`.
+    Fraction(double number)
+    {
+        if (!std::isfinite(number))
+        {
+            throw std::runtime_error("Error: Cannot convert NaN or infinity to fraction.");
+        }
+        if (std::abs(number) > INT_MAX)
+        {
+            throw std::runtime_error("Error: The number is too large to convert to fraction.");
+        }
+
+        // |number| == n / 2^k exactly, n < 2^53 and k > 0 since |number| < 2^31
+        int exp;
+        const double abs = std::abs(number);
+        const long long n = std::ldexp(std::frexp(abs, &exp), 53);
+        const int k = 53 - exp;
+
+        auto [num, den] = k < 64 ? convergent<unsigned long long>(n, 1ull << k, abs) : convergent<Int>(n, Int::pow(2, k), abs);
+        num_ = number < 0 ? -num : num;
+        den_ = den;
+    }
+
+    /// Copy constructor.
+    Fraction(const Fraction& that) = default;
+
+    /// Move constructor.
+    Fraction(Fraction&& that)
+        : num_(std::move(that.num_))
+        , den_(std::move(that.den_))
+    {
+        that.num_ = 0;
+        that.den_ = 1;
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Compare the fraction with another fraction.
+    auto operator<=>(const Fraction& that) const
+    {
+        // this = a/b; that = c/d;
+        // so, this - that = a/b - c/d = (ad - bc)/(bd)
+        // since bd is always positive, compute (ad-bc) only
+        const int a = this->num_;
+        const int b = this->den_;
+        const int c = that.num_;
+        const int d = that.den_;
+
+        return a * d - b * c;
+    }
+
+    /*
+     * Assignment
+     */
+
+    /// Copy assignment operator.
+    Fraction& operator=(const Fraction& that) = default;
+
+    /// Move assignment operator.
+    Fraction& operator=(Fraction&& that)
+    {
+        num_ = std::move(that.num_);
+        den_ = std::move(that.den_);
+
+        that.num_ = 0;
+        that.den_ = 1;
+
+        return *this;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Convert the fraction to double type.
+    operator double() const
+    {
+        return double(num_) / double(den_);
+    }
+
+    /// Get the numerator of this.
+    int numerator() const
+    {
+        return num_;
+    }
+
+    /// Get the denominator of this.
+    int denominator() const
+    {
+        return den_;
+    }
+
+    /// Return the pair of the numerator and the denominator.
+    std::pair<int, int> as_integer_ratio() const
+    {
+        return {num_, den_};
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs`.
+    Fraction& operator+=(const Fraction& rhs)
+    {
+        return add(rhs.num_, rhs.den_);
+    }
+
+    /// Return this -= `rhs`.
+    Fraction& operator-=(const Fraction& rhs)
+    {
+        return add(-rhs.num_, rhs.den_);
+    }
+
+    /// Return this *= `rhs`.
+    Fraction& operator*=(const Fraction& rhs)
+    {
+        // cancel across before multiplying, the products are then already simplified
+        const int g1 = std::gcd(num_, rhs.den_);
+        const int g2 = std::gcd(rhs.num_, den_);
+        num_ = (num_ / g1) * (rhs.num_ / g2);
+        den_ = (den_ / g2) * (rhs.den_ / g1);
+        return *this;
+    }
+
+    /// Return this /= `rhs` (not zero).
+    Fraction& operator/=(const Fraction& rhs)
+    {
+        detail::check_zero(rhs.num_);
+
+        // multiply by rhs.den_/rhs.num_
+        const int g1 = std::gcd(num_, rhs.num_);
+        const int g2 = std::gcd(rhs.den_, den_);
+        num_ = (num_ / g1) * (rhs.den_ / g2);
+        den_ = (den_ / g2) * (rhs.num_ / g1);
+        if (den_ < 0)
+        {
+            num_ = -num_;
+            den_ = -den_;
+        }
+        return *this;
+    }
+
+    /// Return this %= `rhs` (not zero).
+    Fraction& operator%=(const Fraction& rhs)
+    {
+        return *this = *this % rhs;
+    }
+
+    /// Increment the value by 1.
+    Fraction& operator++()
+    {
+        num_ += den_;
+        return *this;
+    }
+
+    /// Decrement the value by 1.
+    Fraction& operator--()
+    {
+        num_ -= den_;
+        return *this;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the copy of this.
+    Fraction operator+() const
+    {
+        return *this;
+    }
+
+    /// Return the opposite value of this.
+    Fraction operator-() const
+    {
+        return Fraction(-num_, den_);
+    }
+
+    /// Return the absolute value of this.
+    Fraction abs() const
+    {
+        return Fraction(std::abs(num_), den_);
+    }
+
+    /// Return this + `rhs`.
+    Fraction operator+(const Fraction& rhs) const
+    {
+        return Fraction(*this) += rhs;
+    }
+
+    /// Return this - `rhs`.
+    Fraction operator-(const Fraction& rhs) const
+    {
+        return Fraction(*this) -= rhs;
+    }
+
+    /// Return this * `rhs`.
+    Fraction operator*(const Fraction& rhs) const
+    {
+        return Fraction(*this) *= rhs;
+    }
+
+    /// Return this / `rhs` (not zero).
+    Fraction operator/(const Fraction& rhs) const
+    {
+        return Fraction(*this) /= rhs;
+    }
+
+    /// Return this % `rhs` (not zero).
+    Fraction operator%(const Fraction& rhs) const
+    {
+        detail::check_zero(rhs);
+
+        return Fraction((num_ * rhs.den_) % (rhs.num_ * den_), den_ * rhs.den_);
+    }
+
+    /// Return the closest fraction to this with denominator at most `max_den`.
+    /// If `max_den` < 1, throw a `runtime_error`.
+    ///
+    /// ### Example
+    /// ```
+    /// Fraction(3.141592653589793).limit_denominator(1000); // 355/113
+    /// ```
+    Fraction limit_denominator(int max_den) const
+    {
+        if (max_den < 1)
+        {
+            throw std::runtime_error("Error: Require max_den >= 1 for limit_denominator(max_den).");
+        }
+
+        auto [num, den] = detail::limit_denominator<long long>(num_, den_, max_den);
+        return Fraction(int(num), int(den));
+    }
+
+    /// Calculate the greatest common divisor of two fractions.
+    static Fraction gcd(const Fraction& a, const Fraction& b)
+    {
+        return detail::gcd(a, b);
+    }
+
+    /// Calculate the least common multiple of two fractions.
+    static Fraction lcm(const Fraction& a, const Fraction& b)
+    {
+        if (a == 0 || b == 0)
+        {
+            return 0;
+        }
+
+        return (a * b).abs() / gcd(a, b); // LCM = |a * b| / GCD
+    }
+
+    /// Return the sum of fractions in range [`first`, `last`).
+    /// Numerators are accumulated over the running LCM of the denominators and simplified once at the end,
+    /// in machine words while they fit and in Int after that.
+    /// If the simplified sum doesn't fit in Fraction, throw a `runtime_error`.
+    ///
+    /// ### Example
+    /// ```
+    /// List<Fraction> list = {Fraction(1, 2), Fraction(1, 3), Fraction(1, 6)};
+    /// Fraction::sum(list.begin(), list.end()); // 1
+    /// ```
+    template <std::input_iterator InputIt>
+    static Fraction sum(InputIt first, InputIt last)
+    {
+        constexpr long long LIMIT = LLONG_MAX / 2;
+
+        // num/den in machine words, |num| and den stay below LIMIT so that a step can't overflow
+        long long num = 0;
+        long long den = 1;
+        for (; first != last; ++first)
+        {
+            const Fraction& f = *first;
+            long long g = std::gcd(den, (long long)f.den_);
+            long long scale = f.den_ / g;
+            auto fits = [&]()
+            {
+                return den <= LIMIT / scale && std::abs(num) <= LIMIT / scale && den / g <= LIMIT / std::max(std::abs((long long)f.num_), 1ll);
+            };
+
+            if (!fits())
+            {
+                const long long g2 = std::gcd(num, den);
+                num /= g2;
+                den /= g2;
+                g = std::gcd(den, (long long)f.den_);
+                scale = f.den_ / g;
+                if (!fits())
+                {
+                    break;
+                }
+            }
+
+            num = num * scale + f.num_ * (den / g);
+            den *= scale;
+        }
+
+        if (first == last)
+        {
+            const long long g = std::gcd(num, den);
+            num /= g;
+            den /= g;
+            if (std::abs(num) > INT_MAX || den > INT_MAX)
+            {
+                throw std::runtime_error("Error: The result is too large to compute.");
+            }
+
+            return Fraction(int(num), int(den));
+        }
+
+        // the rest in Int
+        Int big_num = num;
+        Int big_den = den;
+        for (; first != last; ++first)
+        {
+            const Fraction& f = *first;
+            const int g = std::gcd((big_den % f.den_).to_number<int>(), f.den_);
+            const int scale = f.den_ / g;
+            big_num = big_num * scale + big_den / g * f.num_;
+            big_den *= scale;
+        }
+
+        const Int g = Int::gcd(big_num, big_den);
+        big_num /= g;
+        big_den /= g;
+        if (big_num.abs() > INT_MAX || big_den > INT_MAX)
+        {
+            throw std::runtime_error("Error: The result is too large to compute.");
+        }
+
+        return Fraction(big_num.to_number<int>(), big_den.to_number<int>());
+    }
+
+    /*
+     * Print / Input
+     */
+
+    /// Output the fraction to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const Fraction& fraction)
+    {
+        if (fraction.den_ == 1)
+        {
+            return os << fraction.num_;
+        }
+        else
+        {
+            return os << fraction.num_ << "/" << fraction.den_;
+        }
+    }
+
+    /// Get a fraction from the specified input stream.
+    ///
+    /// ### Example
+    /// ```
+    /// Fraction f1, f2;
+    /// std::istringstream("+1/-2 233") >> f1 >> f2;
+    /// // f1 == Fraction(-1, 2);
+    /// // f2 == Fraction(233);
+    /// ```
+    friend std::istream& operator>>(std::istream& is, Fraction& fraction)
+    {
+        while (is.peek() <= 0x20)
+        {
+            is.ignore();
+        }
+        if (!(std::isdigit(is.peek()) || is.peek() == '-' || is.peek() == '+')) // handle "z1/2"
+        {
+            throw std::runtime_error("Error: Wrong fraction literal.");
+        }
+
+        int num;
+        is >> num;
+        if (is.peek() <= 0x20) // next char is white space, ok
+        {
+            fraction = num;
+            return is;
+        }
+
+        char c;
+        int den;
+        is >> c;
+        if (!(std::isdigit(is.peek()) || is.peek() == '-' || is.peek() == '+')) // handle "1z/2" or "1/z2"
+        {
+            throw std::runtime_error("Error: Wrong fraction literal.");
+        }
+        is >> den;
+        if (c != '/' || is.peek() > 0x20) // handle "1|2" or "1/2z"
+        {
+            throw std::runtime_error("Error: Wrong fraction literal.");
+        }
+        fraction = Fraction(num, den);
+        return is;
+    }
+};
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::Fraction> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::Fraction& fraction) const
+    {
+        const int parts[] = {fraction.numerator(), fraction.denominator()};
+        return pyincpp::detail::hash_bytes(parts, sizeof(parts));
+    }
+};
+
+#endif // FRACTION_HPP
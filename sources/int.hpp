@@ -1,1026 +1,2482 @@
-//! @file int.hpp
-//! @author Chen QingYu <chen_qingyu@qq.com>
-//! @brief Int class.
-//! @date 2023.01.21
-
-#ifndef INT_HPP
-#define INT_HPP
-
-#include "detail.hpp"
-
-namespace pyincpp
-{
-
-/// Int provides support for big integer arithmetic.
-class Int
-{
-private:
-    // Base radix of digits.
-    static constexpr int BASE = 1'000'000'000; // 10^(floor(log10(INT_MAX)))
-
-    // Number of decimal digits per chunk.
-    static constexpr int DIGITS_PER_CHUNK = 9; // ceil(log10(base));
-
-    // Sign of integer, 1 is positive, -1 is negative, and 0 is zero.
-    signed char sign_;
-
-    // List of digits, represent absolute value of the integer, little endian.
-    // Example: `123456789000`
-    // ```
-    // chunk: 456789000 123
-    // index: 0         1
-    // ```
-    std::vector<int> chunks_;
-
-    // Remove leading zeros and correct sign.
-    Int& trim()
-    {
-        while (!chunks_.empty() && chunks_.back() == 0)
-        {
-            chunks_.pop_back();
-        }
-
-        if (chunks_.empty())
-        {
-            sign_ = 0;
-        }
-
-        return *this;
-    }
-
-    // Test whether the characters represent an integer.
-    static bool is_integer(const char* chars, int len)
-    {
-        if (len == 0 || (len == 1 && (chars[0] == '+' || chars[0] == '-')))
-        {
-            return false;
-        }
-
-        for (int i = (chars[0] == '+' || chars[0] == '-'); i < len; ++i)
-        {
-            // surprisingly, this is faster than `!std::isdigit(chars[i])`
-            // my guess is that the conversion of char to int takes time
-            if (chars[i] < '0' || chars[i] > '9')
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-
-    // Increase the absolute value by 1 quickly.
-    void abs_inc()
-    {
-        assert(sign_ != 0);
-
-        // add a leading zero for carry
-        chunks_.push_back(0);
-
-        int i = 0;
-        while (chunks_[i] == BASE - 1)
-        {
-            ++i;
-        }
-        ++chunks_[i];
-        while (i != 0)
-        {
-            chunks_[--i] = 0;
-        }
-
-        trim(); // sign unchanged
-    }
-
-    // Decrease the absolute value by 1 quickly.
-    void abs_dec()
-    {
-        assert(sign_ != 0);
-
-        int i = 0;
-        while (chunks_[i] == 0)
-        {
-            ++i;
-        }
-        --chunks_[i];
-        while (i != 0)
-        {
-            chunks_[--i] = BASE - 1;
-        }
-
-        trim(); // sign may change to zero
-    }
-
-    // This is equal to Python's "//".
-    // `a == (a floor_div b) * b + a cycle_mod b`
-    static int floor_div(int a, int b)
-    {
-        int q = a / b;
-        return q * b == a ? q : q - ((a < 0) ^ (b < 0)); // if not modulo and signs different then - 1
-    }
-
-    // This is equal to Python's "%".
-    // `a == (a floor_div b) * b + a cycle_mod b`
-    static int cycle_mod(int a, int b)
-    {
-        return a - floor_div(a, b) * b;
-    }
-
-    // Compare absolute value.
-    int abs_cmp(const Int& that) const
-    {
-        if (chunks_.size() != that.chunks_.size())
-        {
-            return chunks_.size() > that.chunks_.size() ? 1 : -1;
-        }
-
-        for (int i = chunks_.size() - 1; i >= 0; --i) // i = -1 if is zero, ok
-        {
-            if (chunks_[i] != that.chunks_[i])
-            {
-                return chunks_[i] > that.chunks_[i] ? 1 : -1;
-            }
-        }
-
-        return 0;
-    }
-
-    // Helper constructor.
-    Int(signed char sign, const std::vector<int>& chunks)
-        : sign_(sign)
-        , chunks_(chunks)
-    {
-    }
-
-    // Multiply with small int. O(N)
-    void small_mul(int n)
-    {
-        assert(is_positive());
-        assert(n > 0 && n < BASE);
-
-        int carry = 0;
-        for (auto& chunk : chunks_)
-        {
-            long long tmp = 1ll * chunk * n + carry;
-            chunk = tmp % BASE; // t%b < b
-            carry = tmp / BASE; // t/b <= ((b-1)*(b-1) + (b-1))/b = b - 1 < b
-        }
-        chunks_.push_back(carry);
-
-        trim();
-    }
-
-    // Divide with small int. O(N)
-    // Return the remainder.
-    int small_div(int n)
-    {
-        assert(is_positive());
-        assert(n > 0 && n < BASE);
-
-        long long r = 0;
-        for (auto& chunk : chunks_ | std::views::reverse)
-        {
-            r = r * BASE + chunk;
-            chunk = r / n; // r/n <= ((n-1)*b+(b-1))/n = (n*b - 1)/n < b
-            r %= n;        // r%n < r%b < b
-        }
-
-        trim();
-        return int(r);
-    }
-
-public:
-    /*
-     * Constructor
-     */
-
-    /// Create an integer based on the given integer `n` (default = 0).
-    /// @tparam T a primitive integer type: int (default), long, etc.
-    template <std::integral T = int>
-    Int(T n = 0)
-    {
-        sign_ = n == 0 ? 0 : (n > 0 ? 1 : -1);
-        n = std::abs(n);
-        while (n > 0)
-        {
-            chunks_.push_back(n % BASE);
-            n /= BASE;
-        }
-    }
-
-    /// Create an integer based on the given null-terminated characters.
-    Int(const char* chars)
-    {
-        const int len = std::strlen(chars);
-        if (!is_integer(chars, len))
-        {
-            throw std::runtime_error("Error: Wrong integer literal.");
-        }
-
-        sign_ = (chars[0] == '-' ? -1 : 1);
-
-        // skip symbol
-        std::string_view digits(chars + (chars[0] == '-' || chars[0] == '+'), chars + len);
-
-        const int chunks_len = std::ceil(double(digits.size()) / DIGITS_PER_CHUNK);
-        chunks_.resize(chunks_len, 0);
-
-        // every DIGITS_PER_CHUNK digits into a chunk (align right)
-        int chunk = 0;
-        int idx = chunks_len;
-        for (int i = 0; i < digits.size(); ++i)
-        {
-            chunk = chunk * 10 + (digits[i] - '0'); // faster than (digits[i] ^ 0x30) in -O2
-            // I think maybe it's not the fastest, but it's the most elegant
-            if ((i + 1) % DIGITS_PER_CHUNK == digits.size() % DIGITS_PER_CHUNK)
-            {
-                chunks_[--idx] = chunk;
-                chunk = 0;
-            }
-        }
-
-        trim();
-    }
-
-    /// Copy constructor.
-    Int(const Int& that) = default;
-
-    /// Move constructor.
-    Int(Int&& that)
-        : sign_(std::move(that.sign_))
-        , chunks_(std::move(that.chunks_))
-    {
-        that.sign_ = 0;
-    }
-
-    /*
-     * Comparison
-     */
-
-    /// Determine whether this integer is equal to another integer.
-    bool operator==(const Int& that) const
-    {
-        return sign_ == that.sign_ && chunks_ == that.chunks_;
-    }
-
-    /// Compare the integer with another integer.
-    auto operator<=>(const Int& that) const
-    {
-        if (sign_ != that.sign_)
-        {
-            return sign_ - that.sign_;
-        }
-
-        return sign_ >= 0 ? abs_cmp(that) : -abs_cmp(that);
-    }
-
-    /*
-     * Assignment
-     */
-
-    /// Copy assignment operator.
-    Int& operator=(const Int& that) = default;
-
-    /// Move assignment operator.
-    Int& operator=(Int&& that)
-    {
-        sign_ = std::move(that.sign_);
-        chunks_ = std::move(that.chunks_);
-
-        that.sign_ = 0;
-
-        return *this;
-    }
-
-    /*
-     * Examination
-     */
-
-    /// Return the number of digits in the integer (based 10).
-    int digits() const
-    {
-        if (chunks_.empty())
-        {
-            return 0;
-        }
-
-        return (chunks_.size() - 1) * DIGITS_PER_CHUNK + std::floor(std::log10(chunks_.back())) + 1;
-    }
-
-    /// Determine whether the integer is zero quickly.
-    bool is_zero() const
-    {
-        return sign_ == 0;
-    }
-
-    /// Determine whether the integer is positive quickly.
-    bool is_positive() const
-    {
-        return sign_ == 1;
-    }
-
-    /// Determine whether the integer is negative quickly.
-    bool is_negative() const
-    {
-        return sign_ == -1;
-    }
-
-    /// Determine whether the integer is even quickly.
-    bool is_even() const
-    {
-        return is_zero() ? true : (chunks_[0] & 1) == 0;
-    }
-
-    /// Determine whether the integer is odd quickly.
-    bool is_odd() const
-    {
-        return is_zero() ? false : (chunks_[0] & 1) == 1;
-    }
-
-    /// Determine whether the integer is prime number.
-    bool is_prime() const
-    {
-        if (*this <= 1)
-        {
-            return false; // prime >= 2
-        }
-
-        Int s = sqrt(*this);
-        for (Int n = 2; n <= s; n.abs_inc())
-        {
-            if ((*this % n).is_zero())
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-
-    /*
-     * Manipulation
-     */
-
-    /// Return this += `rhs`.
-    Int& operator+=(const Int& rhs)
-    {
-        // if one of the operands is zero, just return another one
-        if (sign_ == 0 || rhs.sign_ == 0)
-        {
-            return sign_ == 0 ? *this = rhs : *this;
-        }
-
-        // if the operands are of opposite signs, perform subtraction
-        if (sign_ != rhs.sign_)
-        {
-            return *this -= -rhs;
-        }
-
-        // now, the sign of two integers is the same and not zero
-
-        // normalize
-        auto& a = chunks_;
-        const auto& b = rhs.chunks_;
-        a.resize(std::max(a.size(), b.size()) + 1); // a.len is max+1
-
-        // calculate
-        for (int i = 0; i < b.size(); ++i)
-        {
-            int tmp = a[i] + b[i]; // t <= (b-1) + (b-1) < 2*b = 2'000'000'000 < INT_MAX
-            a[i] = tmp % BASE;
-            a[i + 1] += tmp / BASE; // 1 or 0
-        }
-        for (int i = b.size(); i < a.size() && a[i] >= BASE; ++i) // carry
-        {
-            ++a[i + 1];
-            a[i] = 0;
-        }
-
-        return trim();
-    }
-
-    /// Return this -= `rhs`.
-    Int& operator-=(const Int& rhs)
-    {
-        // if one of the operands is zero
-        if (sign_ == 0 || rhs.sign_ == 0)
-        {
-            return sign_ == 0 ? *this = -rhs : *this;
-        }
-
-        // if the operands are of opposite signs, perform addition
-        if (sign_ != rhs.sign_)
-        {
-            return *this += -rhs;
-        }
-
-        // now, the sign of two integers is the same and not zero
-
-        // normalize
-        std::vector<int> rhs_digits = rhs.chunks_;
-        if (abs_cmp(rhs) == -1) // let a.len >= b.len
-        {
-            sign_ = -sign_;
-            chunks_.swap(rhs_digits);
-        }
-        auto& a = chunks_;
-        const auto& b = rhs_digits;
-        a.push_back(0);
-
-        // calculate
-        for (int i = 0; i < b.size(); ++i)
-        {
-            int tmp = a[i] - b[i];
-            a[i] = cycle_mod(tmp, BASE);
-            a[i + 1] += floor_div(tmp, BASE); // -1 or 0
-        }
-        for (int i = b.size(); i < a.size() && a[i] < 0; ++i) // carry
-        {
-            --a[i + 1];
-            a[i] = BASE - 1;
-        }
-
-        return trim();
-    }
-
-    /// Return this *= `rhs`.
-    Int& operator*=(const Int& rhs)
-    {
-        // if one of the operands is zero, just return zero
-        if (sign_ == 0 || rhs.sign_ == 0)
-        {
-            return *this = 0;
-        }
-
-        // now, the sign of two integers is not zero
-
-        // normalize
-        const auto& a = chunks_;
-        const auto& b = rhs.chunks_;
-        Int result(sign_ == rhs.sign_ ? 1 : -1, std::vector<int>(a.size() + b.size()));
-        auto& c = result.chunks_;
-
-        // calculate
-        for (int i = 0; i < a.size(); ++i)
-        {
-            for (int j = 0; j < b.size(); ++j)
-            {
-                long long tmp = 1ll * a[i] * b[j] + c[i + j];
-                c[i + j] = tmp % BASE;      // t%b < b
-                c[i + j + 1] += tmp / BASE; // be modulo by the previous line in the next loop, or finally c + t/b <= 0 + ((b-1)^2 + (b-1))/b = b - 1 < b
-            }
-        }
-
-        return *this = result.trim();
-    }
-
-    /// Return this /= `rhs`.
-    /// Divide by zero will throw a `runtime_error` exception.
-    Int& operator/=(const Int& rhs)
-    {
-        return *this = divmod(rhs).first;
-    }
-
-    /// Return this %= `rhs`.
-    /// Divide by zero will throw a `runtime_error` exception.
-    Int& operator%=(const Int& rhs)
-    {
-        return *this = divmod(rhs).second;
-    }
-
-    /// Return the quotient and remainder simultaneously.
-    /// `this == (this / rhs) * rhs + this % rhs`
-    /// Divide by zero will throw a `runtime_error` exception.
-    std::pair<Int, Int> divmod(const Int& rhs) const
-    {
-        // if rhs is zero, throw an exception
-        detail::check_zero(rhs.sign_);
-
-        // if this.abs < rhs.abs, just return {0, this}
-        if (digits() < rhs.digits())
-        {
-            return {0, *this};
-        }
-
-        // now, the sign of two integers is not zero
-
-        // if rhs < base, then use small_div in O(N)
-        if (rhs.chunks_.size() == 1)
-        {
-            Int a = abs();                                   // can't be chained cause q is ref
-            int r = a.small_div(rhs.chunks_[0]);             // this.abs divmod rhs.abs
-            return {sign_ == rhs.sign_ ? a : -a, sign_ * r}; // r.sign = this.sign
-        }
-
-        // dividend, divisor, temporary quotient, accumulated quotient
-        Int a = abs(), b = rhs.abs(), t = 1, q = 0;
-
-        // double ~ left shift, O(log(2^N))) * O(N) = O(N^2)
-        while (a.abs_cmp(b) >= 0)
-        {
-            b.small_mul(2);
-            t.small_mul(2);
-        }
-
-        // halve ~ right shift, O(log(2^N))) * O(N) = O(N^2)
-        while (t.is_positive())
-        {
-            if (a.abs_cmp(b) >= 0)
-            {
-                a -= b;
-                q += t;
-            }
-            b.small_div(2);
-            t.small_div(2);
-        }
-
-        // now q is the quotient.abs, a is the remainder.abs
-        return {sign_ == rhs.sign_ ? q : -q, sign_ == 1 ? a : -a};
-    }
-
-    /// Increase the value by 1 quickly.
-    Int& operator++()
-    {
-        if (sign_ == 1)
-        {
-            abs_inc();
-        }
-        else if (sign_ == -1)
-        {
-            abs_dec();
-        }
-        else
-        {
-            sign_ = 1;
-            chunks_.push_back(1);
-        }
-
-        return *this;
-    }
-
-    /// Decrease the value by 1 quickly.
-    Int& operator--()
-    {
-        if (sign_ == 1)
-        {
-            abs_dec();
-        }
-        else if (sign_ == -1)
-        {
-            abs_inc();
-        }
-        else
-        {
-            sign_ = -1;
-            chunks_.push_back(1);
-        }
-
-        return *this;
-    }
-
-    /*
-     * Production
-     */
-
-    /// Return the copy of this.
-    Int operator+() const
-    {
-        return *this;
-    }
-
-    /// Return the opposite value of this.
-    Int operator-() const
-    {
-        return Int(-sign_, chunks_);
-    }
-
-    /// Return the absolute value of this.
-    Int abs() const
-    {
-        return Int(std::abs(sign_), chunks_);
-    }
-
-    /// Return this + `rhs`.
-    Int operator+(const Int& rhs) const
-    {
-        return Int(*this) += rhs;
-    }
-
-    /// Return this - `rhs`.
-    Int operator-(const Int& rhs) const
-    {
-        return Int(*this) -= rhs;
-    }
-
-    /// Return this * `rhs`.
-    Int operator*(const Int& rhs) const
-    {
-        return Int(*this) *= rhs;
-    }
-
-    /// Return this / `rhs`.
-    /// Divide by zero will throw a `runtime_error` exception.
-    Int operator/(const Int& rhs) const
-    {
-        return Int(*this) /= rhs;
-    }
-
-    /// Return this % `rhs`.
-    /// Divide by zero will throw a `runtime_error` exception.
-    Int operator%(const Int& rhs) const
-    {
-        return Int(*this) %= rhs;
-    }
-
-    /// Return the factorial of this.
-    Int factorial() const
-    {
-        if (sign_ == -1)
-        {
-            throw std::runtime_error("Error: Require this >= 0 for factorial().");
-        }
-
-        Int result = 1; // 0! == 1
-
-        for (Int i = *this; i.is_positive(); i.abs_dec()) // fast judgement, fast decrement
-        {
-            result *= i;
-        }
-
-        return result;
-    }
-
-    /// Calculate the next prime that greater than this.
-    Int next_prime() const
-    {
-        if (*this < 2)
-        {
-            return 2;
-        }
-
-        Int prime = *this; // >= 2
-
-        // if prime is even, let it odd and < this, because prime > 2 is odd and while prime += 2
-        if (prime.is_even())
-        {
-            prime.abs_dec();
-        }
-
-        // prime >= 1
-        while (true)
-        {
-            prime += 2;
-
-            if (prime.is_prime())
-            {
-                break;
-            }
-        }
-
-        return prime;
-    }
-
-    /// Attempt to convert this integer to a number of the specified type `T`.
-    /// @tparam T a numeric type: int (default), long, double, etc. or any custom numeric type.
-    template <typename T = int>
-    T to_number() const
-    {
-        T result = 0;
-        for (const auto& chunk : chunks_ | std::views::reverse)
-        {
-            result = result * BASE + chunk;
-        }
-        return result * sign_;
-    }
-
-    /*
-     * Static
-     */
-
-    /// Return the square root of integer `n`.
-    static Int sqrt(const Int& n)
-    {
-        if (n.sign_ == -1)
-        {
-            throw std::runtime_error("Error: Require n >= 0 for sqrt(n).");
-        }
-
-        // binary search
-        Int lo = 0, hi = n, res;
-        while (lo <= hi)
-        {
-            Int mid = lo + (hi - lo) / 2;
-
-            if (mid * mid <= n) // if mid^2 <= n, update the result and search in upper half
-            {
-                res = mid;
-                lo = mid + 1;
-            }
-            else // else mid^2 > n, search in the lower half
-            {
-                hi = mid - 1;
-            }
-        }
-
-        return res;
-    }
-
-    /// Return `(base**exp) % mod` (`mod` default = 0 means does not perform module).
-    static Int pow(const Int& base, const Int& exp, const Int& mod = 0)
-    {
-        // if base.abs is 1, only when base is negative and exp is odd return -1, otherwise return 1
-        if (base.chunks_.size() == 1 && base.chunks_[0] == 1)
-        {
-            return base.sign_ == -1 && exp.is_odd() ? -1 : 1;
-        }
-
-        // then, check if exp is negative
-        if (exp.is_negative())
-        {
-            if (base.is_zero())
-            {
-                throw std::runtime_error("Error: Math domain error.");
-            }
-
-            return 0;
-        }
-
-        // fast power algorithm
-        Int num = base, n = exp, res = 1;
-        while (!n.is_zero())
-        {
-            if (n.is_odd())
-            {
-                res = mod.is_zero() ? res * num : (res * num) % mod;
-            }
-            num = mod.is_zero() ? num * num : (num * num) % mod;
-            n.small_div(2);
-        }
-
-        return res;
-    }
-
-    /// Return the logarithm of integer `n` based on integer `base`.
-    static Int log(const Int& n, const Int& base)
-    {
-        if (n.sign_ <= 0 || base < 2)
-        {
-            throw std::runtime_error("Error: Math domain error.");
-        }
-
-        if (base == 10) // log10 == digits-1
-        {
-            return n.digits() - 1;
-        }
-
-        Int num = n / base, res;
-        while (!num.is_zero())
-        {
-            ++res;
-            num /= base;
-        }
-
-        return res;
-    }
-
-    /// Calculate the greatest common divisor of two integers.
-    static Int gcd(const Int& a, const Int& b)
-    {
-        return detail::gcd(a, b);
-    }
-
-    /// Calculate the least common multiple of two integers.
-    static Int lcm(const Int& a, const Int& b)
-    {
-        if (a.is_zero() || b.is_zero())
-        {
-            return 0;
-        }
-
-        return (a * b).abs() / gcd(a, b); // LCM = |a * b| / GCD
-    }
-
-    /// Generate a random integer in [`a`, `b`].
-    ///
-    /// ### Example
-    /// ```
-    /// random(0, 9); // x in [0, 9]
-    /// random(1, 6); // x in [1, 6]
-    /// ```
-    static Int random(const Int& a, const Int& b)
-    {
-        if (b < a)
-        {
-            throw std::runtime_error("Error: Require a >= b for random(a, b).");
-        }
-
-        std::mt19937 gen(std::random_device{}());
-        std::uniform_real_distribution<long double> dis(0.0, 1.0); // [0, 1)
-
-        return Int((long long)(dis(gen) * (b - a + 1).to_number<long double>())) + a; // [a, b]
-    }
-
-    /// Generate a random integer of a specified number of `digits`.
-    ///
-    /// ### Example
-    /// ```
-    /// random(1); // x in [1, 9]
-    /// random(3); // x in [100, 999]
-    /// ```
-    static Int random(int digits)
-    {
-        if (digits <= 0)
-        {
-            throw std::runtime_error("Error: Require digits > 0 for random(digits).");
-        }
-
-        // random number generator
-        std::mt19937 gen(std::random_device{}());
-
-        // little chunks
-        auto chunks = std::vector<int>((digits - 1) / DIGITS_PER_CHUNK);
-        std::uniform_int_distribution<int> chunk(0, BASE - 1);
-        std::for_each(chunks.begin(), chunks.end(), [&](auto& x)
-                      { x = chunk(gen); });
-
-        // most significant chunk
-        int n = (digits - 1) % DIGITS_PER_CHUNK + 1;
-        std::uniform_int_distribution<int> most_chunk(std::pow(10, n - 1), std::pow(10, n) - 1);
-        chunks.push_back(most_chunk(gen));
-
-        return Int(1, chunks);
-    }
-
-    /// Calculate the `n`th term of the Fibonacci sequence: 0 (n=0), 1, 1, 2, 3, 5, ...
-    static Int fibonacci(const Int& n)
-    {
-        if (n.is_negative())
-        {
-            throw std::runtime_error("Error: Require n >= 0 for fibonacci(n).");
-        }
-
-        // ref: https://sicp-solutions.net/post/sicp-solution-exercise-1-19
-
-        // T_pq(a, b) = (bq + aq + ap, bp + aq)
-        // T_pq(T_pq(a, b)) = ((bp+aq)q + (bq+aq+ap)q + (bq+aq+ap)p, (bp+aq)p + (bq+aq+ap)q)
-        //                  = (b(2pq+q^2) + a(p^2+q^2) + a(2pq+q^2), b(p^2+q^2) + a(2pq+q^2))
-        //                  = T_p'q'(a, b)
-        // => p' = p^2 + q^2, q' = 2pq + q^2
-
-        Int a = 1, b = 0, p = 0, q = 1, cnt = n;
-        while (!cnt.is_zero())
-        {
-            if (cnt.is_even())
-            {
-                Int p_ = p * p + q * q;
-                Int q_ = p * q * 2 + q * q;
-                p = p_;
-                q = q_;
-                cnt.small_div(2);
-            }
-            else
-            {
-                Int a_ = b * q + a * (p + q);
-                Int b_ = b * p + a * q;
-                a = a_;
-                b = b_;
-                cnt.abs_dec();
-            }
-        }
-        return b;
-    }
-
-    /// The well-known Ackermann function (perhaps not so well-known) is a rapidly growing function.
-    /// Please input parameters carefully.
-    /// See: https://en.wikipedia.org/wiki/Ackermann_function
-    static Int ackermann(const Int& m, const Int& n)
-    {
-        if (m.is_negative() || n.is_negative())
-        {
-            throw std::runtime_error("Error: Require m >= 0 and n >= 0 for ackermann(m, n).");
-        }
-
-        // ref: https://rosettacode.org/wiki/Ackermann_function
-        switch (m.to_number())
-        {
-            case 0:
-                return n + 1;
-            case 1:
-                return n + 2;
-            case 2:
-                return n * 2 + 3;
-            case 3:
-                return Int::pow(2, n + 3) - 3;
-            default:
-                return n.is_zero() ? ackermann(m - 1, 1) : ackermann(m - 1, ackermann(m, n - 1));
-        }
-    }
-
-    /// The hyperoperation sequence is an infinite sequence of arithmetic operations.
-    /// This sequence starts with unary successor (n = 0), continues with addition (n = 1), multiplication (n = 2), exponentiation (n = 3), etc.
-    /// See: https://en.wikipedia.org/wiki/Hyperoperation
-    static Int hyperoperation(const Int& n, const Int& a, const Int& b)
-    {
-        if (n.is_negative() || a.is_negative() || b.is_negative())
-        {
-            throw std::runtime_error("Error: Require n >= 0 and a >= 0 and b >= 0 for hyperoperation(n, a, b).");
-        }
-
-        // special cases
-        if (n > 3)
-        {
-            if (a.is_zero() && b.is_even())
-            {
-                return 1;
-            }
-            else if (a.is_zero() && b.is_odd())
-            {
-                return 0;
-            }
-            else if (a == 1 || b.is_zero())
-            {
-                return 1;
-            }
-            else if (b == 1)
-            {
-                return a;
-            }
-            else if (a == 2 && b == 2)
-            {
-                return 4;
-            }
-        }
-
-        switch (n.to_number())
-        {
-            case 0:
-                return Int(1) + b;
-            case 1:
-                return a + b;
-            case 2:
-                return a * b;
-            case 3:
-                return Int::pow(a, b);
-            default:
-                return hyperoperation(n - 1, a, hyperoperation(n, a, b - 1));
-        }
-    }
-
-    /*
-     * Print / Input
-     */
-
-    /// Output the integer to the specified output stream.
-    friend std::ostream& operator<<(std::ostream& os, const Int& integer)
-    {
-        if (integer.sign_ == 0)
-        {
-            return os << '0';
-        }
-
-        if (integer.sign_ == -1)
-        {
-            os << '-';
-        }
-
-        os << *integer.chunks_.rbegin();
-        if (integer.chunks_.size() > 1)
-        {
-            std::for_each(integer.chunks_.rbegin() + 1, integer.chunks_.rend(), [&](const auto& c)
-                          { os << std::setw(Int::DIGITS_PER_CHUNK) << std::setfill('0') << std::to_string(c); });
-        }
-
-        return os;
-    }
-
-    /// Get an integer from the specified input stream.
-    friend std::istream& operator>>(std::istream& is, Int& integer)
-    {
-        std::string str;
-        is >> str;
-        integer = str.c_str();
-
-        return is;
-    }
-
-    friend struct std::hash<pyincpp::Int>;
-};
-
-} // namespace pyincpp
-
-template <>
-struct std::hash<pyincpp::Int> // explicit specialization
-{
-    std::size_t operator()(const pyincpp::Int& integer) const
-    {
-        std::size_t value = std::hash<signed char>{}(integer.sign_);
-
-        for (const auto& d : integer.chunks_)
-        {
-            value ^= std::hash<int>{}(d) << 1;
-        }
-
-        return value;
-    }
-};
-
-#endif // INT_HPP
+//! @file int.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Int class.
+//! @date 2023.01.21
+
+#ifndef INT_HPP
+#define INT_HPP
+
+#include "detail.hpp"
+
+#include "list.hpp"
+
+namespace pyincpp
+{
+
+/// Int provides support for big integer arithmetic.
+/// Construction, comparison and arithmetic are constexpr, so big constants can be computed and checked at compile time,
+/// but a non-zero Int can't be kept in a constexpr variable, because its chunks are allocated dynamically.
+class Int
+{
+private:
+    // Base radix of digits.
+    static constexpr int BASE = 1'000'000'000; // 10^(floor(log10(INT_MAX)))
+
+    // Number of decimal digits per chunk.
+    static constexpr int DIGITS_PER_CHUNK = 9; // ceil(log10(base));
+
+    // Maximum number of digits converted by Horner's method, more digits are converted by divide and conquer.
+    static constexpr int CONVERSION_THRESHOLD = 512;
+
+    // Minimum number of chunks of both operands to use Karatsuba multiplication.
+    static constexpr int KARATSUBA_THRESHOLD = 32;
+
+    // Minimum number of chunks of both operands to compute sub-products in parallel.
+    static constexpr int PARALLEL_THRESHOLD = 1024;
+
+    // Maximum number of threads used by multiplication, 1 means serial.
+    static inline int threads_ = 1;
+
+    // Decimal digits of 00-99, two characters each.
+    static constexpr auto DIGIT_PAIRS = []()
+    {
+        std::array<char, 200> table{};
+        for (int i = 0; i < 100; ++i)
+        {
+            table[i * 2] = '0' + i / 10;
+            table[i * 2 + 1] = '0' + i % 10;
+        }
+        return table;
+    }();
+
+    // Vector of chunks, allocated from the memory resource of the current thread.
+    using Chunks = std::vector<int, detail::Allocator<int>>;
+
+    // Sign of integer, 1 is positive, -1 is negative, and 0 is zero.
+    signed char sign_;
+
+    // List of digits, represent absolute value of the integer, little endian.
+    // Example: `123456789000`
+    // ```
+    // chunk: 456789000 123
+    // index: 0         1
+    // ```
+    Chunks chunks_;
+
+    // Remove leading zeros and correct sign.
+    constexpr Int& trim()
+    {
+        while (!chunks_.empty() && chunks_.back() == 0)
+        {
+            chunks_.pop_back();
+        }
+
+        if (chunks_.empty())
+        {
+            sign_ = 0;
+        }
+
+        return *this;
+    }
+
+    // Test whether the characters represent an integer.
+    static constexpr bool is_integer(const char* chars, int len)
+    {
+        if (len == 0 || (len == 1 && (chars[0] == '+' || chars[0] == '-')))
+        {
+            return false;
+        }
+
+        for (int i = (chars[0] == '+' || chars[0] == '-'); i < len; ++i)
+        {
+            // surprisingly, this is faster than `!std::isdigit(chars[i])`
+            // my guess is that the conversion of char to int takes time
+            if (chars[i] < '0' || chars[i] > '9')
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Increase the absolute value by 1 quickly.
+    constexpr void abs_inc()
+    {
+        assert(sign_ != 0);
+
+        // add a leading zero for carry
+        chunks_.push_back(0);
+
+        int i = 0;
+        while (chunks_[i] == BASE - 1)
+        {
+            ++i;
+        }
+        ++chunks_[i];
+        while (i != 0)
+        {
+            chunks_[--i] = 0;
+        }
+
+        trim(); // sign unchanged
+    }
+
+    // Decrease the absolute value by 1 quickly.
+    constexpr void abs_dec()
+    {
+        assert(sign_ != 0);
+
+        int i = 0;
+        while (chunks_[i] == 0)
+        {
+            ++i;
+        }
+        --chunks_[i];
+        while (i != 0)
+        {
+            chunks_[--i] = BASE - 1;
+        }
+
+        trim(); // sign may change to zero
+    }
+
+    // Add absolute value of `b` to `a` in place, `b` is aligned to the chunk `offset` of `a`.
+    // First add lane by lane without carry (no dependency between chunks, so it can be vectorized),
+    // then fix up the carries by comparison instead of division.
+    static constexpr void abs_add(Chunks& a, std::span<const int> b, int offset = 0)
+    {
+        const int end = offset + b.size();
+        if (a.size() < end)
+        {
+            a.resize(end);
+        }
+
+        for (int i = 0; i < b.size(); ++i)
+        {
+            a[offset + i] += b[i]; // t <= (b-1) + (b-1) < 2*b = 2'000'000'000 < INT_MAX
+        }
+
+        int carry = 0;
+        for (int i = offset; i < a.size() && (i < end || carry); ++i)
+        {
+            a[i] += carry;            // t <= 2*b - 1
+            carry = a[i] >= BASE;     // 1 or 0
+            a[i] -= carry ? BASE : 0; // branch free
+        }
+        if (carry)
+        {
+            a.push_back(carry);
+        }
+    }
+
+    // Subtract absolute value of `b` from `a` in place (require a.abs >= b.abs).
+    // First subtract lane by lane without borrow (no dependency between chunks, so it can be vectorized),
+    // then fix up the borrows by comparison instead of division.
+    static constexpr void abs_sub(Chunks& a, std::span<const int> b)
+    {
+        assert(a.size() >= b.size());
+
+        for (int i = 0; i < b.size(); ++i)
+        {
+            a[i] -= b[i]; // -b < t < b
+        }
+
+        int borrow = 0;
+        for (int i = 0; i < a.size() && (i < b.size() || borrow); ++i)
+        {
+            a[i] -= borrow;            // t >= -b
+            borrow = a[i] < 0;         // 1 or 0
+            a[i] += borrow ? BASE : 0; // branch free
+        }
+    }
+
+    // Compare absolute value.
+    constexpr int abs_cmp(const Int& that) const
+    {
+        if (chunks_.size() != that.chunks_.size())
+        {
+            return chunks_.size() > that.chunks_.size() ? 1 : -1;
+        }
+
+        for (int i = chunks_.size() - 1; i >= 0; --i) // i = -1 if is zero, ok
+        {
+            if (chunks_[i] != that.chunks_[i])
+            {
+                return chunks_[i] > that.chunks_[i] ? 1 : -1;
+            }
+        }
+
+        return 0;
+    }
+
+    // Return the number of decimal digits of a chunk (0 < chunk < base).
+    static constexpr int chunk_digits(int chunk)
+    {
+        int n = 1;
+        for (int p = 10; n < DIGITS_PER_CHUNK && chunk >= p; p *= 10)
+        {
+            ++n;
+        }
+        return n;
+    }
+
+    // Write exactly DIGITS_PER_CHUNK decimal digits (with leading zeros) of a chunk to `out`.
+    // Two digits at a time by table lookup, divisions by constants are compiled to multiplications, no branch.
+    static constexpr void write_chunk(int chunk, char* out)
+    {
+        int hi = chunk / 10000; // 5 digits
+        int lo = chunk % 10000; // 4 digits
+
+        out[0] = '0' + hi / 10000;
+        hi %= 10000;
+        std::copy_n(&DIGIT_PAIRS[hi / 100 * 2], 2, out + 1);
+        std::copy_n(&DIGIT_PAIRS[hi % 100 * 2], 2, out + 3);
+        std::copy_n(&DIGIT_PAIRS[lo / 100 * 2], 2, out + 5);
+        std::copy_n(&DIGIT_PAIRS[lo % 100 * 2], 2, out + 7);
+    }
+
+    // Long division of absolute values by Knuth's algorithm D, require a.len >= b.len >= 2. O(N*M)
+    // Return the quotient and the remainder (maybe with leading zeros).
+    // See: The Art of Computer Programming, Volume 2, Section 4.3.1
+    static constexpr std::pair<Chunks, Chunks> divmod_knuth(std::span<const int> a, std::span<const int> b)
+    {
+        const int n = b.size(), m = a.size() - b.size();
+
+        // normalize, let the most significant chunk of divisor >= base/2, then the estimated quotient chunk is at most 2 greater
+        const int d = BASE / (b.back() + 1);
+        auto scale = [d](Chunks& x)
+        {
+            long long carry = 0;
+            for (auto& chunk : x)
+            {
+                long long tmp = 1ll * chunk * d + carry;
+                chunk = tmp % BASE;
+                carry = tmp / BASE;
+            }
+        };
+        Chunks u(a.begin(), a.end()), v(b.begin(), b.end());
+        u.push_back(0);
+        scale(u);
+        scale(v); // no carry out since (b.back() + 1) * d <= base
+
+        Chunks q(m + 1);
+        for (int j = m; j >= 0; --j)
+        {
+            // estimate the quotient chunk by the top two chunks of dividend and the top two chunks of divisor
+            long long num = 1ll * u[j + n] * BASE + u[j + n - 1];
+            long long qhat = num / v[n - 1];
+            long long rhat = num % v[n - 1];
+            while (qhat >= BASE || qhat * v[n - 2] > rhat * BASE + u[j + n - 2])
+            {
+                --qhat;
+                rhat += v[n - 1];
+                if (rhat >= BASE)
+                {
+                    break;
+                }
+            }
+
+            // multiply and subtract
+            long long carry = 0;
+            for (int i = 0; i < n; ++i)
+            {
+                long long p = qhat * v[i] + carry;
+                carry = p / BASE;
+                long long tmp = u[i + j] - p % BASE;
+                if (tmp < 0)
+                {
+                    tmp += BASE;
+                    ++carry;
+                }
+                u[i + j] = tmp;
+            }
+            u[j + n] -= carry;
+
+            // the estimation was 1 greater (rare), add back
+            if (u[j + n] < 0)
+            {
+                --qhat;
+                int c = 0;
+                for (int i = 0; i < n; ++i)
+                {
+                    u[i + j] += v[i] + c;
+                    c = u[i + j] >= BASE;
+                    u[i + j] -= c ? BASE : 0;
+                }
+                u[j + n] += c; // back to zero
+            }
+
+            q[j] = qhat;
+        }
+
+        // unnormalize the remainder
+        Chunks r(u.begin(), u.begin() + n);
+        long long rem = 0;
+        for (auto& chunk : r | std::views::reverse)
+        {
+            rem = rem * BASE + chunk;
+            chunk = rem / d;
+            rem %= d;
+        }
+
+        return {std::move(q), std::move(r)};
+    }
+
+    // Return base^(CONVERSION_THRESHOLD * 2^k), cached for reuse by the current thread.
+    static const Int& power_of(int base, int k)
+    {
+        static thread_local std::deque<Int> cache[37]; // deque, references are stable when growing
+
+        auto& powers = cache[base];
+        if (powers.size() <= k)
+        {
+            Scope scope(std::pmr::new_delete_resource()); // cached integers may outlive the current scope
+            while (powers.size() <= k)
+            {
+                powers.push_back(powers.empty() ? pow(base, CONVERSION_THRESHOLD) : powers.back() * powers.back());
+            }
+        }
+
+        return powers[k];
+    }
+
+    // Try to transform a character to a digit based on 2-36 base, return 36 if it is not a digit.
+    static constexpr int digit_value(char ch)
+    {
+        if (ch >= '0' && ch <= '9')
+        {
+            return ch - '0';
+        }
+        if (ch >= 'a' && ch <= 'z')
+        {
+            return ch - 'a' + 10;
+        }
+        if (ch >= 'A' && ch <= 'Z')
+        {
+            return ch - 'A' + 10;
+        }
+        return 36;
+    }
+
+    // Parse 8 decimal digits at once by SWAR (SIMD within a register).
+    // See: https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits
+    static constexpr int parse_8_digits(const char* digits)
+    {
+        if (std::endian::native == std::endian::little && !std::is_constant_evaluated())
+        {
+            const std::uint64_t mask = 0x000000FF000000FF;
+            const std::uint64_t mul1 = 100 + (1000000ull << 32);
+            const std::uint64_t mul2 = 1 + (10000ull << 32);
+
+            std::uint64_t v;
+            std::memcpy(&v, digits, 8);
+            v -= 0x3030303030303030;                                   // subtract '0' from every byte
+            v = v * 10 + (v >> 8);                                     // 2 digits in every 2 bytes
+            v = ((v & mask) * mul1 + ((v >> 16) & mask) * mul2) >> 32; // 8 digits
+            return int(v);
+        }
+        else // big endian, or in constant evaluation
+        {
+            int v = 0;
+            for (int i = 0; i < 8; ++i)
+            {
+                v = v * 10 + (digits[i] - '0');
+            }
+            return v;
+        }
+    }
+
+    // Set this to the value of decimal digits in [`first`, `last`), every DIGITS_PER_CHUNK digits into a chunk (align right).
+    constexpr void parse_decimal(const char* first, const char* last)
+    {
+        const int len = last - first;
+        chunks_.resize((len + DIGITS_PER_CHUNK - 1) / DIGITS_PER_CHUNK);
+
+        for (auto& chunk : chunks_)
+        {
+            if (last - first >= DIGITS_PER_CHUNK)
+            {
+                last -= DIGITS_PER_CHUNK;
+                chunk = parse_8_digits(last) * 10 + (last[8] - '0');
+            }
+            else // most significant chunk
+            {
+                chunk = 0;
+                for (const char* it = first; it != last; ++it)
+                {
+                    chunk = chunk * 10 + (*it - '0');
+                }
+            }
+        }
+
+        sign_ = 1;
+        trim();
+    }
+
+    // Convert digits in [`first`, `last`) based on `base` by Horner's method, every digits that fit in a chunk at a time. O(N^2)
+    static Int parse_digits_basecase(const char* first, const char* last, int base)
+    {
+        // max power of base less than the base of chunk
+        int k = 1, m = base;
+        while (1ll * m * base < BASE)
+        {
+            m *= base;
+            ++k;
+        }
+
+        Chunks chunks;
+        for (const char* it = first; it != last;)
+        {
+            int group = 0, mul = 1;
+            for (const char* end = it + std::min<int>(k, last - it); it != end; ++it)
+            {
+                group = group * base + digit_value(*it);
+                mul *= base;
+            }
+
+            // chunks = chunks * mul + group
+            long long carry = group;
+            for (auto& chunk : chunks)
+            {
+                long long tmp = 1ll * chunk * mul + carry;
+                chunk = tmp % BASE;
+                carry = tmp / BASE;
+            }
+            if (carry)
+            {
+                chunks.push_back(carry);
+            }
+        }
+
+        return Int(1, std::move(chunks)).trim();
+    }
+
+    // Convert digits in [`first`, `last`) based on `base` by divide and conquer. O(M(N)*log(N))
+    static Int parse_digits(const char* first, const char* last, int base)
+    {
+        const int len = last - first;
+        if (len <= CONVERSION_THRESHOLD)
+        {
+            return parse_digits_basecase(first, last, base);
+        }
+
+        // split at the largest power of two times threshold less than len, so powers can be shared
+        int k = 0;
+        while ((CONVERSION_THRESHOLD << (k + 1)) < len)
+        {
+            ++k;
+        }
+
+        const char* mid = last - (CONVERSION_THRESHOLD << k);
+        Int result = parse_digits(first, mid, base);
+        result *= power_of(base, k);
+        return result += parse_digits(mid, last, base);
+    }
+
+    // Append the digits of non-negative `n` based on `base` to `str` by repeated division, pad with leading zeros to `width`. O(N^2)
+    static void write_digits_basecase(const Int& n, int base, int width, std::string& str)
+    {
+        // max power of base less than the base of chunk
+        int k = 1, m = base;
+        while (1ll * m * base < BASE)
+        {
+            m *= base;
+            ++k;
+        }
+
+        std::string digits; // little endian
+        for (Int t = n; !t.is_zero();)
+        {
+            int r = t.small_div(m);
+            for (int i = 0; i < k; ++i)
+            {
+                digits += "0123456789abcdefghijklmnopqrstuvwxyz"[r % base];
+                r /= base;
+            }
+        }
+        while (!digits.empty() && digits.back() == '0')
+        {
+            digits.pop_back();
+        }
+
+        str.append(std::max<int>(width - digits.size(), 0), '0');
+        str.append(digits.rbegin(), digits.rend());
+    }
+
+    // Append the digits of non-negative `n` based on `base` to `str` by divide and conquer, pad with leading zeros to `width`. O(D(N)*log(N))
+    static void write_digits(const Int& n, int base, int width, std::string& str)
+    {
+        if (n.abs_cmp(power_of(base, 0)) < 0)
+        {
+            return write_digits_basecase(n, base, width, str);
+        }
+
+        // split by the largest cached power about the square root of n, so n > power
+        int k = 0;
+        while (power_of(base, k + 1).chunks_.size() * 2 <= n.chunks_.size() + 1)
+        {
+            ++k;
+        }
+
+        const int low = CONVERSION_THRESHOLD << k;
+        auto [q, r] = n.divmod(power_of(base, k));
+        write_digits(q, base, std::max(width - low, 0), str);
+        write_digits(r, base, low, str);
+    }
+
+    // Helper constructor.
+    constexpr Int(signed char sign, Chunks chunks)
+        : sign_(sign)
+        , chunks_(std::move(chunks))
+    {
+    }
+
+    // Schoolbook multiplication of absolute values. O(N*M)
+    static constexpr Chunks mul_basecase(std::span<const int> a, std::span<const int> b)
+    {
+        Chunks c(a.size() + b.size());
+
+        for (int i = 0; i < a.size(); ++i)
+        {
+            for (int j = 0; j < b.size(); ++j)
+            {
+                long long tmp = 1ll * a[i] * b[j] + c[i + j];
+                c[i + j] = tmp % BASE;      // t%b < b
+                c[i + j + 1] += tmp / BASE; // be modulo by the previous line in the next loop, or finally c + t/b <= 0 + ((b-1)^2 + (b-1))/b = b - 1 < b
+            }
+        }
+
+        return c;
+    }
+
+    // Compute the sub-products {a0 * b0, sa * sb, a1 * b1} of Karatsuba multiplication in parallel.
+    // Not constexpr, so it is kept out of mul_karatsuba.
+    static std::tuple<Chunks, Chunks, Chunks> mul_karatsuba_parallel(std::span<const int> a0, std::span<const int> a1, std::span<const int> b0, std::span<const int> b1, std::span<const int> sa, std::span<const int> sb, int threads)
+    {
+        // split the threads between three sub-products
+        const int t = std::max(threads / 3, 1);
+        auto f2 = std::async(std::launch::async, mul_karatsuba, a1, b1, t);
+        auto f0 = std::async(threads >= 3 ? std::launch::async : std::launch::deferred, mul_karatsuba, a0, b0, t);
+        Chunks z1 = mul_karatsuba(sa, sb, std::max(threads - 2 * t, 1));
+        return {f0.get(), std::move(z1), f2.get()};
+    }
+
+    // Karatsuba multiplication of absolute values, use up to `threads` threads. O(N^log2(3))
+    // The result has exactly a.len + b.len chunks (maybe with leading zeros).
+    static constexpr Chunks mul_karatsuba(std::span<const int> a, std::span<const int> b, int threads)
+    {
+        if (a.size() < b.size())
+        {
+            std::swap(a, b);
+        }
+
+        // now, a.len >= b.len
+
+        if (b.size() < KARATSUBA_THRESHOLD)
+        {
+            return mul_basecase(a, b);
+        }
+
+        const int m = a.size() / 2;
+        Chunks c(a.size() + b.size());
+
+        // unbalanced: a = a1 * base^m + a0, a * b = (a1 * b) * base^m + a0 * b
+        if (b.size() <= m)
+        {
+            abs_add(c, mul_karatsuba(a.first(m), b, threads));
+            abs_add(c, mul_karatsuba(a.subspan(m), b, threads), m);
+            c.resize(a.size() + b.size()); // drop the leading zero pushed by carry, if any
+            return c;
+        }
+
+        // balanced: a = a1 * base^m + a0, b = b1 * base^m + b0
+        // a * b = z2 * base^2m + z1 * base^m + z0
+        // z2 = a1 * b1, z0 = a0 * b0, z1 = (a0 + a1) * (b0 + b1) - z2 - z0
+        auto a0 = a.first(m), a1 = a.subspan(m);
+        auto b0 = b.first(m), b1 = b.subspan(m);
+
+        Chunks sa(a0.begin(), a0.end()), sb(b0.begin(), b0.end());
+        abs_add(sa, a1);
+        abs_add(sb, b1);
+
+        Chunks z0, z1, z2;
+        if (threads > 1 && b.size() >= PARALLEL_THRESHOLD)
+        {
+            std::tie(z0, z1, z2) = mul_karatsuba_parallel(a0, a1, b0, b1, sa, sb, threads);
+        }
+        else
+        {
+            z2 = mul_karatsuba(a1, b1, threads);
+            z0 = mul_karatsuba(a0, b0, threads);
+            z1 = mul_karatsuba(sa, sb, threads);
+        }
+        abs_sub(z1, z2); // z1 >= z2 + z0
+        abs_sub(z1, z0);
+
+        abs_add(c, z0);
+        abs_add(c, z1, m);
+        abs_add(c, z2, 2 * m);
+        c.resize(a.size() + b.size()); // drop the leading zeros of z1, they are all zeros
+        return c;
+    }
+
+    // Tetration a^^b = a^(a^(...^a)) with `b` copies of `a` by repeated exponentiation, require a >= 2 and b >= 1.
+    // The size of every power is estimated before computing it, so an impossible result fails fast.
+    static Int tetration(const Int& a, const Int& b)
+    {
+        const double log10_a = a.digits() <= 300 ? std::log10(a.to_double()) : a.digits() - 1; // a lower bound
+
+        Int result = a;
+        for (Int i = 1; i.abs_cmp(b) < 0; ++i) // i < b
+        {
+            // a^result has more than result * log10(a) digits, which must fit in an int
+            if (result.digits() > 18 || result.to_number<long long>() * log10_a >= INT_MAX)
+            {
+                throw std::runtime_error("Error: The result is too large to compute.");
+            }
+            result = pow(a, result);
+        }
+
+        return result;
+    }
+
+    // Return -m^(-1) mod base for the least significant chunk `m` of an odd modulus not divisible by 5.
+    static int montgomery_inverse(int m)
+    {
+        // Hensel lifting from the inverse modulo 10: x = x * (2 - m * x) doubles the number of correct digits
+        static constexpr int inverse_mod_10[10] = {0, 1, 0, 7, 0, 0, 0, 3, 0, 9};
+        long long x = inverse_mod_10[m % 10];
+        for (int i = 0; i < 4; ++i) // 1 -> 2 -> 4 -> 8 -> 16 digits
+        {
+            x = x * (2 + BASE - 1ll * m * x % BASE) % BASE;
+        }
+        return (BASE - x) % BASE;
+    }
+
+    // Montgomery multiplication a * b * R^(-1) mod m, require 0 <= a, b < m, m coprime with base and R = base^m.len.
+    // `m_inv` is montgomery_inverse(m.chunks[0]). The reduction costs about one multiplication and no division. O(N^2)
+    // See: https://en.wikipedia.org/wiki/Montgomery_modular_multiplication
+    static Int mul_montgomery(const Int& a, const Int& b, const Int& m, int m_inv)
+    {
+        if (a.is_zero() || b.is_zero())
+        {
+            return 0;
+        }
+
+        const int k = m.chunks_.size();
+        Chunks t = mul_karatsuba(a.chunks_, b.chunks_, 1);
+        t.resize(2 * k + 1); // t < m^2 < m*R, and the sum below < 2*m*R
+
+        // REDC: add multiples of m to clear the low k chunks one by one, then drop them
+        for (int i = 0; i < k; ++i)
+        {
+            const long long u = 1ll * t[i] * m_inv % BASE; // t + u * m * base^i == 0 (mod base^(i+1))
+            long long carry = 0;
+            for (int j = 0; j < k; ++j)
+            {
+                long long tmp = u * m.chunks_[j] + t[i + j] + carry;
+                t[i + j] = tmp % BASE;
+                carry = tmp / BASE;
+            }
+            for (int j = i + k; carry; ++j)
+            {
+                long long tmp = t[j] + carry;
+                t[j] = tmp % BASE;
+                carry = tmp / BASE;
+            }
+        }
+        t.erase(t.begin(), t.begin() + k);
+
+        Int result(1, std::move(t));
+        result.trim(); // result < 2*m
+        if (result.abs_cmp(m) >= 0)
+        {
+            abs_sub(result.chunks_, m.chunks_);
+            result.trim();
+        }
+        return result;
+    }
+
+    // Multiply with small int. O(N)
+    constexpr void small_mul(int n)
+    {
+        assert(is_positive());
+        assert(n > 0 && n < BASE);
+
+        int carry = 0;
+        for (auto& chunk : chunks_)
+        {
+            long long tmp = 1ll * chunk * n + carry;
+            chunk = tmp % BASE; // t%b < b
+            carry = tmp / BASE; // t/b <= ((b-1)*(b-1) + (b-1))/b = b - 1 < b
+        }
+        chunks_.push_back(carry);
+
+        trim();
+    }
+
+    // Divide with small int. O(N)
+    // Return the remainder.
+    constexpr int small_div(int n)
+    {
+        assert(is_positive());
+        assert(n > 0 && n < BASE);
+
+        long long r = 0;
+        for (auto& chunk : chunks_ | std::views::reverse)
+        {
+            r = r * BASE + chunk;
+            chunk = r / n; // r/n <= ((n-1)*b+(b-1))/n = (n*b - 1)/n < b
+            r %= n;        // r%n < r%b < b
+        }
+
+        trim();
+        return int(r);
+    }
+
+    // Modulo with small int, the remainder of the absolute value. O(N)
+    constexpr int small_mod(int n) const
+    {
+        assert(n > 0 && n < BASE);
+
+        long long r = 0;
+        for (auto chunk : chunks_ | std::views::reverse)
+        {
+            r = (r * BASE + chunk) % n;
+        }
+
+        return int(r);
+    }
+
+    // Return the inverse of `a` modulo `m` in [0, m) by extended Euclidean algorithm, or 0 if not invertible.
+    static Int inverse_mod(const Int& a, const Int& m)
+    {
+        // invariant: x * a == r (mod m), y * a == s (mod m)
+        Int r = a, s = m, x = 1, y = 0;
+        while (!s.is_zero())
+        {
+            auto [q, t] = r.divmod(s);
+            r = std::exchange(s, std::move(t));
+            x = std::exchange(y, x - q * y);
+        }
+
+        if (r != 1)
+        {
+            return 0;
+        }
+        return x.is_negative() ? x + m : x;
+    }
+
+    // Return (a + b) mod m, require 0 <= a, b < m.
+    static Int add_mod(const Int& a, const Int& b, const Int& m)
+    {
+        Int result = a + b;
+        if (result.abs_cmp(m) >= 0)
+        {
+            result -= m;
+        }
+        return result;
+    }
+
+    // Return (a - b) mod m, require 0 <= a, b < m.
+    static Int sub_mod(const Int& a, const Int& b, const Int& m)
+    {
+        Int result = a - b;
+        if (result.is_negative())
+        {
+            result += m;
+        }
+        return result;
+    }
+
+    // Return a^e in Montgomery form, `one` is R mod m.
+    static Int pow_montgomery(const Int& a, const Int& e, const Int& one, const Int& m, int m_inv)
+    {
+        Int result = one, base = a, exp = e;
+        while (!exp.is_zero())
+        {
+            if (exp.is_odd())
+            {
+                result = mul_montgomery(result, base, m, m_inv);
+            }
+            base = mul_montgomery(base, base, m, m_inv);
+            exp.small_div(2);
+        }
+        return result;
+    }
+
+    // Primes less than 1000, for trial division.
+    static constexpr auto SMALL_PRIMES = []()
+    {
+        std::array<int, 168> primes{};
+        for (int n = 2, count = 0; count < 168; ++n)
+        {
+            bool is_prime = true;
+            for (int i = 0; i < count && primes[i] * primes[i] <= n; ++i)
+            {
+                if (n % primes[i] == 0)
+                {
+                    is_prime = false;
+                    break;
+                }
+            }
+            if (is_prime)
+            {
+                primes[count++] = n;
+            }
+        }
+        return primes;
+    }();
+
+    // Miller-Rabin test with the first 12 primes as bases, require n > 10^6 odd and coprime with base.
+    // Deterministic for n < 3.3 * 10^24, and a composite passes with probability less than 4^(-12) otherwise.
+    static bool is_probable_prime(const Int& n)
+    {
+        const int m_inv = montgomery_inverse(n.chunks_[0]);
+        const Int r2 = pow(10, DIGITS_PER_CHUNK * 2 * n.chunks_.size(), n);
+        const Int one = mul_montgomery(1, r2, n, m_inv);
+        const Int minus_one = n - one;
+
+        // n - 1 = d * 2^s, d odd
+        Int d = n - 1;
+        int s = 0;
+        while (d.is_even())
+        {
+            d.small_div(2);
+            ++s;
+        }
+
+        for (int a : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+        {
+            Int x = pow_montgomery(mul_montgomery(a, r2, n, m_inv), d, one, n, m_inv);
+            if (x == one || x == minus_one)
+            {
+                continue;
+            }
+
+            bool is_witness = true;
+            for (int i = 1; i < s && is_witness; ++i)
+            {
+                x = mul_montgomery(x, x, n, m_inv);
+                is_witness = x != minus_one;
+            }
+            if (is_witness)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Pollard-Brent rho with f(y) = y^2 + c in Montgomery form, stop after about `limit` steps.
+    // The differences are multiplied together and one gcd is taken per 128 steps.
+    // Return a factor of n, n if the cycles modulo all factors meet at once, or 0 if out of steps.
+    // See: https://maths-people.anu.edu.au/~brent/pd/rpb051i.pdf
+    static Int pollard_brent(const Int& n, int m_inv, const Int& c, long long limit)
+    {
+        constexpr int BATCH = 128;
+
+        auto f = [&](const Int& y)
+        {
+            return add_mod(mul_montgomery(y, y, n, m_inv), c, n);
+        };
+
+        Int x, y = 2, ys, q = 1, g = 1;
+        for (long long r = 1; g == 1; r *= 2)
+        {
+            if (r > limit)
+            {
+                return 0;
+            }
+
+            x = y;
+            for (long long i = 0; i < r; ++i)
+            {
+                y = f(y);
+            }
+            for (long long k = 0; k < r && g == 1; k += BATCH)
+            {
+                ys = y;
+                for (long long i = 0; i < BATCH && i < r - k; ++i)
+                {
+                    y = f(y);
+                    q = mul_montgomery(q, sub_mod(x, y, n), n, m_inv);
+                }
+                g = gcd(q, n); // R is coprime with n, so the Montgomery factors don't matter
+            }
+        }
+
+        // the batch went past the collision, retrace it one step at a time
+        if (g == n)
+        {
+            do
+            {
+                ys = f(ys);
+                g = gcd(sub_mod(x, ys, n), n);
+            } while (g == 1);
+        }
+
+        return g;
+    }
+
+    // Elliptic curve method on the Montgomery curve of Suyama's parameter `sigma`, with stage 1 bound `b1` and
+    // stage 2 bound `is_composite.size() - 1`, where `is_composite` is a sieve. `r2` is R^2 mod n.
+    // Return a factor of n, or 1 or n if failed.
+    // See: https://members.loria.fr/PZimmermann/papers/ecm-submitted.pdf
+    static Int ecm(const Int& n, int m_inv, const Int& r2, int sigma, int b1, const std::vector<bool>& is_composite)
+    {
+        auto mul = [&](const Int& a, const Int& b)
+        {
+            return mul_montgomery(a, b, n, m_inv);
+        };
+        auto add = [&](const Int& a, const Int& b)
+        {
+            return add_mod(a, b, n);
+        };
+        auto sub = [&](const Int& a, const Int& b)
+        {
+            return sub_mod(a, b, n);
+        };
+
+        // u = sigma^2 - 5, v = 4 * sigma, P = (u^3 : v^3), (A + 2) / 4 = (v - u)^3 * (3u + v) / (16 * u^3 * v)
+        const Int u = mul(Int(1ll * sigma * sigma - 5) % n, r2);
+        const Int v = mul(Int(4ll * sigma) % n, r2);
+        const Int x = mul(mul(u, u), u);
+        const Int z = mul(mul(v, v), v);
+        const Int w = sub(v, u);
+        const Int den = mul(mul(mul(Int(16), r2), x), v);
+
+        const Int g = gcd(den, n); // R is coprime with n
+        if (g != 1)
+        {
+            return g; // a lucky factor, or a bad curve
+        }
+        const Int a24 = mul(mul(mul(mul(w, w), w), add(add(u, add(u, u)), v)), mul(inverse_mod(mul(den, 1), n), r2));
+
+        // 2P
+        auto dbl = [&](Int& px, Int& pz)
+        {
+            Int s = add(px, pz), d = sub(px, pz);
+            s = mul(s, s);
+            d = mul(d, d);
+            const Int t = sub(s, d);
+            px = mul(s, d);
+            pz = mul(t, add(d, mul(a24, t)));
+        };
+
+        // P + Q, the difference P - Q is (dx : dz)
+        auto dadd = [&](Int& px, Int& pz, const Int& qx, const Int& qz, const Int& dx, const Int& dz)
+        {
+            const Int s = mul(sub(px, pz), add(qx, qz));
+            const Int t = mul(add(px, pz), sub(qx, qz));
+            const Int sum = add(s, t), diff = sub(s, t);
+            px = mul(dz, mul(sum, sum));
+            pz = mul(dx, mul(diff, diff));
+        };
+
+        // kP by Montgomery ladder, invariant: R1 - R0 == P
+        auto ladder = [&](Int& px, Int& pz, int k)
+        {
+            Int x0 = px, z0 = pz, x1 = px, z1 = pz;
+            dbl(x1, z1);
+            for (int bit = std::bit_width(unsigned(k)) - 2; bit >= 0; --bit)
+            {
+                if (k >> bit & 1)
+                {
+                    dadd(x0, z0, x1, z1, px, pz);
+                    dbl(x1, z1);
+                }
+                else
+                {
+                    dadd(x1, z1, x0, z0, px, pz);
+                    dbl(x0, z0);
+                }
+            }
+            px = std::move(x0);
+            pz = std::move(z0);
+        };
+
+        // stage 1: Q = kP, k is the product of all maximal prime powers <= b1
+        Int qx = x, qz = z;
+        for (int p = 2; p <= b1; ++p)
+        {
+            if (!is_composite[p])
+            {
+                int k = p;
+                while (1ll * k * p <= b1)
+                {
+                    k *= p;
+                }
+                ladder(qx, qz, k);
+            }
+        }
+
+        Int result = gcd(qz, n);
+        if (result != 1)
+        {
+            return result;
+        }
+
+        // stage 2: find a prime b1 < p <= b2 that pQ == O, write p = j * D +- i, then pQ == O iff jD * Q and iQ
+        // have the same x, so multiply all x_jD * z_i - x_i * z_jD together and take one gcd
+        constexpr int D = 210;
+        const int b2 = int(is_composite.size()) - 1;
+
+        // baby steps iQ for odd i < D / 2, computed by adding 2Q each time
+        std::array<std::pair<Int, Int>, D / 2> baby;
+        Int dx = qx, dz = qz;
+        dbl(dx, dz);
+        baby[1] = {qx, qz};
+        baby[3] = {qx, qz};
+        dadd(baby[3].first, baby[3].second, dx, dz, qx, qz);
+        for (int i = 5; i < D / 2; i += 2)
+        {
+            baby[i] = baby[i - 2];
+            dadd(baby[i].first, baby[i].second, dx, dz, baby[i - 4].first, baby[i - 4].second);
+        }
+
+        // giant steps jD * Q from j = b1 / D, computed by adding D * Q each time
+        Int gx = qx, gz = qz;
+        ladder(gx, gz, D);
+        int j = std::max(b1 / D, 1);
+        Int jx = gx, jz = gz, prev_x = gx, prev_z = gz;
+        ladder(jx, jz, j);
+        if (j == 1)
+        {
+            dbl(jx, jz); // (j - 1) * D * Q is the point at infinity, so start from j = 2
+            ++j;
+        }
+        else
+        {
+            ladder(prev_x, prev_z, j - 1);
+        }
+
+        Int product = 1;
+        for (; j * D - D / 2 <= b2; ++j)
+        {
+            for (int i = 1; i < D / 2; i += 2)
+            {
+                const int p = j * D - i, q = j * D + i;
+                if ((p > b1 && p <= b2 && !is_composite[p]) || (q > b1 && q <= b2 && !is_composite[q]))
+                {
+                    product = mul(product, sub(mul(jx, baby[i].second), mul(baby[i].first, jz)));
+                }
+            }
+
+            Int next_x = jx, next_z = jz;
+            dadd(next_x, next_z, gx, gz, prev_x, prev_z);
+            prev_x = std::exchange(jx, std::move(next_x));
+            prev_z = std::exchange(jz, std::move(next_z));
+        }
+
+        return gcd(product, n);
+    }
+
+    // Return a nontrivial factor of the composite n, require n odd, coprime with base and without prime factors < 1000.
+    static Int find_factor(const Int& n)
+    {
+        const int m_inv = montgomery_inverse(n.chunks_[0]);
+
+        // Pollard-Brent rho finds factors up to about 10 digits quickly
+        for (int c = 1; c <= 3; ++c)
+        {
+            Int d = pollard_brent(n, m_inv, c, 1 << 16);
+            if (d.is_zero())
+            {
+                break; // out of steps, the factors are large
+            }
+            if (d != n)
+            {
+                return d;
+            }
+        }
+
+        // ECM for larger factors, the bounds grow slowly with the number of curves
+        const Int r2 = pow(10, DIGITS_PER_CHUNK * 2 * n.chunks_.size(), n);
+        std::vector<bool> is_composite;
+        for (int sigma = 6, b1 = 2000;; ++sigma)
+        {
+            if (is_composite.size() != 50 * b1 + 1)
+            {
+                // sieve of Eratosthenes up to b2 = 50 * b1
+                is_composite.assign(50 * b1 + 1, false);
+                for (long long p = 2; p * p <= 50 * b1; ++p)
+                {
+                    if (!is_composite[p])
+                    {
+                        for (long long i = p * p; i <= 50 * b1; i += p)
+                        {
+                            is_composite[i] = true;
+                        }
+                    }
+                }
+            }
+
+            Int d = ecm(n, m_inv, r2, sigma, b1, is_composite);
+            if (d != 1 && d != n)
+            {
+                return d;
+            }
+            if (sigma % 16 == 0)
+            {
+                b1 += b1 / 2;
+            }
+        }
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an integer based on the given integer `n` (default = 0).
+    /// @tparam T a primitive integer type: int (default), long, etc.
+    template <std::integral T = int>
+    constexpr Int(T n = 0)
+    {
+        sign_ = n == 0 ? 0 : (n > 0 ? 1 : -1);
+        for (; n != 0; n /= BASE)
+        {
+            chunks_.push_back(n % BASE * sign_); // without std::abs, so the minimum value does not overflow
+        }
+    }
+
+    /// Create an integer with the exact value of the given double `number` truncated toward zero, like Python's `int(float)`.
+    /// If the number is NaN or infinity, throw a `runtime_error`.
+    explicit Int(double number)
+        : Int()
+    {
+        if (!std::isfinite(number))
+        {
+            throw std::runtime_error("Error: Cannot convert NaN or infinity to integer.");
+        }
+
+        number = std::trunc(number);
+        if (std::abs(number) < 0x1p63)
+        {
+            *this = (long long)number;
+            return;
+        }
+
+        // number = mantissa * 2^exp exactly, the mantissa has 53 bits
+        int exp;
+        const double fraction = std::frexp(number, &exp);
+        *this = (long long)std::ldexp(fraction, 53);
+        *this *= pow(2, exp - 53);
+    }
+
+    /// Create an integer based on the given null-terminated characters.
+    constexpr Int(const char* chars)
+    {
+        const int len = std::char_traits<char>::length(chars);
+        if (!is_integer(chars, len))
+        {
+            throw std::runtime_error("Error: Wrong integer literal.");
+        }
+
+        // skip symbol
+        parse_decimal(chars + (chars[0] == '-' || chars[0] == '+'), chars + len);
+
+        if (chars[0] == '-')
+        {
+            sign_ = -sign_;
+        }
+    }
+
+    /// Copy constructor.
+    constexpr Int(const Int& that) = default;
+
+    /// Move constructor.
+    constexpr Int(Int&& that)
+        : sign_(std::move(that.sign_))
+        , chunks_(std::move(that.chunks_))
+    {
+        that.sign_ = 0;
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this integer is equal to another integer.
+    constexpr bool operator==(const Int& that) const
+    {
+        return sign_ == that.sign_ && chunks_ == that.chunks_;
+    }
+
+    /// Compare the integer with another integer.
+    constexpr auto operator<=>(const Int& that) const
+    {
+        if (sign_ != that.sign_)
+        {
+            return sign_ - that.sign_;
+        }
+
+        return sign_ >= 0 ? abs_cmp(that) : -abs_cmp(that);
+    }
+
+    /*
+     * Assignment
+     */
+
+    /// Copy assignment operator.
+    constexpr Int& operator=(const Int& that) = default;
+
+    /// Move assignment operator.
+    constexpr Int& operator=(Int&& that)
+    {
+        sign_ = std::move(that.sign_);
+        chunks_ = std::move(that.chunks_);
+
+        that.sign_ = 0;
+        that.chunks_.clear(); // chunks are copied rather than stolen if the allocators are different
+
+        return *this;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of digits in the integer (based 10).
+    constexpr int digits() const
+    {
+        if (chunks_.empty())
+        {
+            return 0;
+        }
+
+        return (chunks_.size() - 1) * DIGITS_PER_CHUNK + chunk_digits(chunks_.back());
+    }
+
+    /// Determine whether the integer is zero quickly.
+    constexpr bool is_zero() const
+    {
+        return sign_ == 0;
+    }
+
+    /// Determine whether the integer is positive quickly.
+    constexpr bool is_positive() const
+    {
+        return sign_ == 1;
+    }
+
+    /// Determine whether the integer is negative quickly.
+    constexpr bool is_negative() const
+    {
+        return sign_ == -1;
+    }
+
+    /// Determine whether the integer is even quickly.
+    constexpr bool is_even() const
+    {
+        return is_zero() ? true : (chunks_[0] & 1) == 0;
+    }
+
+    /// Determine whether the integer is odd quickly.
+    constexpr bool is_odd() const
+    {
+        return is_zero() ? false : (chunks_[0] & 1) == 1;
+    }
+
+    /// Determine whether the integer is prime number.
+    constexpr bool is_prime() const
+    {
+        if (*this <= 1)
+        {
+            return false; // prime >= 2
+        }
+
+        Int s = sqrt(*this);
+        for (Int n = 2; n <= s; n.abs_inc())
+        {
+            if ((*this % n).is_zero())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs`.
+    constexpr Int& operator+=(const Int& rhs)
+    {
+        // if one of the operands is zero, just return another one
+        if (sign_ == 0 || rhs.sign_ == 0)
+        {
+            return sign_ == 0 ? *this = rhs : *this;
+        }
+
+        // if the operands are of opposite signs, perform subtraction
+        if (sign_ != rhs.sign_)
+        {
+            return *this -= -rhs;
+        }
+
+        // now, the sign of two integers is the same and not zero
+
+        abs_add(chunks_, rhs.chunks_);
+
+        return trim();
+    }
+
+    /// Return this -= `rhs`.
+    constexpr Int& operator-=(const Int& rhs)
+    {
+        // if one of the operands is zero
+        if (sign_ == 0 || rhs.sign_ == 0)
+        {
+            return sign_ == 0 ? *this = -rhs : *this;
+        }
+
+        // if the operands are of opposite signs, perform addition
+        if (sign_ != rhs.sign_)
+        {
+            return *this += -rhs;
+        }
+
+        // now, the sign of two integers is the same and not zero
+
+        // let a.abs >= b.abs
+        if (abs_cmp(rhs) >= 0)
+        {
+            abs_sub(chunks_, rhs.chunks_);
+        }
+        else
+        {
+            Chunks a = rhs.chunks_;
+            abs_sub(a, chunks_);
+            chunks_ = std::move(a); // not swap, the allocators may be different
+            sign_ = -sign_;
+        }
+
+        return trim();
+    }
+
+    /// Return this *= `rhs`.
+    constexpr Int& operator*=(const Int& rhs)
+    {
+        // if one of the operands is zero, just return zero
+        if (sign_ == 0 || rhs.sign_ == 0)
+        {
+            return *this = 0;
+        }
+
+        // now, the sign of two integers is not zero
+
+        Int result(sign_ == rhs.sign_ ? 1 : -1, mul_karatsuba(chunks_, rhs.chunks_, std::is_constant_evaluated() ? 1 : threads_));
+
+        return *this = result.trim();
+    }
+
+    /// Return this /= `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr Int& operator/=(const Int& rhs)
+    {
+        return *this = divmod(rhs).first;
+    }
+
+    /// Return this %= `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr Int& operator%=(const Int& rhs)
+    {
+        return *this = divmod(rhs).second;
+    }
+
+    /// Return the quotient and remainder simultaneously.
+    /// `this == (this / rhs) * rhs + this % rhs`
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr std::pair<Int, Int> divmod(const Int& rhs) const
+    {
+        // if rhs is zero, throw an exception
+        detail::check_zero(rhs.sign_);
+
+        // if this.abs < rhs.abs, just return {0, this}
+        if (abs_cmp(rhs) < 0)
+        {
+            return {0, *this};
+        }
+
+        // now, the sign of two integers is not zero
+
+        // if rhs < base, then use small_div in O(N)
+        if (rhs.chunks_.size() == 1)
+        {
+            Int a = abs();                       // can't be chained cause q is ref
+            int r = a.small_div(rhs.chunks_[0]); // this.abs divmod rhs.abs, a > 0 since this.abs >= rhs.abs
+            a.sign_ = sign_ * rhs.sign_;         // q.sign = this.sign * rhs.sign
+            return {std::move(a), sign_ * r};    // r.sign = this.sign
+        }
+
+        // long division in O(N*M)
+        auto [q, r] = divmod_knuth(chunks_, rhs.chunks_);
+        Int quotient(sign_ == rhs.sign_ ? 1 : -1, std::move(q));
+        Int remainder(sign_, std::move(r)); // r.sign = this.sign
+        return {std::move(quotient.trim()), std::move(remainder.trim())};
+    }
+
+    /// Increase the value by 1 quickly.
+    constexpr Int& operator++()
+    {
+        if (sign_ == 1)
+        {
+            abs_inc();
+        }
+        else if (sign_ == -1)
+        {
+            abs_dec();
+        }
+        else
+        {
+            sign_ = 1;
+            chunks_.push_back(1);
+        }
+
+        return *this;
+    }
+
+    /// Decrease the value by 1 quickly.
+    constexpr Int& operator--()
+    {
+        if (sign_ == 1)
+        {
+            abs_dec();
+        }
+        else if (sign_ == -1)
+        {
+            abs_inc();
+        }
+        else
+        {
+            sign_ = -1;
+            chunks_.push_back(1);
+        }
+
+        return *this;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the copy of this.
+    constexpr Int operator+() const
+    {
+        return *this;
+    }
+
+    /// Return the opposite value of this.
+    constexpr Int operator-() const
+    {
+        return Int(-sign_, chunks_);
+    }
+
+    /// Return the absolute value of this.
+    constexpr Int abs() const
+    {
+        return Int(sign_ * sign_, chunks_);
+    }
+
+    /// Return this + `rhs`.
+    constexpr Int operator+(const Int& rhs) const
+    {
+        return Int(*this) += rhs;
+    }
+
+    /// Return this - `rhs`.
+    constexpr Int operator-(const Int& rhs) const
+    {
+        return Int(*this) -= rhs;
+    }
+
+    /// Return this * `rhs`.
+    constexpr Int operator*(const Int& rhs) const
+    {
+        return Int(*this) *= rhs;
+    }
+
+    /// Return this / `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr Int operator/(const Int& rhs) const
+    {
+        return Int(*this) /= rhs;
+    }
+
+    /// Return this % `rhs`.
+    /// Divide by zero will throw a `runtime_error` exception.
+    constexpr Int operator%(const Int& rhs) const
+    {
+        return Int(*this) %= rhs;
+    }
+
+    /// Return the factorial of this.
+    constexpr Int factorial() const
+    {
+        if (sign_ == -1)
+        {
+            throw std::runtime_error("Error: Require this >= 0 for factorial().");
+        }
+
+        Int result = 1; // 0! == 1
+
+        for (Int i = *this; i.is_positive(); i.abs_dec()) // fast judgement, fast decrement
+        {
+            result *= i;
+        }
+
+        return result;
+    }
+
+    /// Calculate the next prime that greater than this.
+    constexpr Int next_prime() const
+    {
+        if (*this < 2)
+        {
+            return 2;
+        }
+
+        Int prime = *this; // >= 2
+
+        // if prime is even, let it odd and < this, because prime > 2 is odd and while prime += 2
+        if (prime.is_even())
+        {
+            prime.abs_dec();
+        }
+
+        // prime >= 1
+        while (true)
+        {
+            prime += 2;
+
+            if (prime.is_prime())
+            {
+                break;
+            }
+        }
+
+        return prime;
+    }
+
+    /// Return the prime factors of the absolute value of this in ascending order, repeated by multiplicity.
+    /// Factors below 1000 are found by trial division, larger ones by Pollard-Brent rho and then by the elliptic curve method,
+    /// so factors up to about 20 digits are found in seconds.
+    /// If this is 0, throw a `runtime_error`.
+    ///
+    /// ### Example
+    /// ```
+    /// Int(-360).factorize(); // [2, 2, 2, 3, 3, 5]
+    /// ```
+    List<Int> factorize() const
+    {
+        if (is_zero())
+        {
+            throw std::runtime_error("Error: Require this != 0 for factorize().");
+        }
+
+        List<Int> factors;
+        Int n = abs();
+        for (int p : SMALL_PRIMES)
+        {
+            while (n.small_mod(p) == 0)
+            {
+                n.small_div(p);
+                factors += p;
+            }
+        }
+
+        // the remaining factors are all > 1000, so n < 1000^2 is 1 or a prime
+        List<Int> composites;
+        if (n < 1'000'000)
+        {
+            if (n != 1)
+            {
+                factors += n;
+            }
+        }
+        else
+        {
+            composites += n;
+        }
+
+        while (!composites.is_empty())
+        {
+            Int m = composites.remove(-1);
+            if (m < 1'000'000 || is_probable_prime(m))
+            {
+                factors += m;
+            }
+            else
+            {
+                Int d = find_factor(m);
+                composites += m / d;
+                composites += d;
+            }
+        }
+
+        return factors.sort();
+    }
+
+    /// Attempt to convert this integer to a number of the specified type `T`.
+    /// @tparam T a numeric type: int (default), long, double, etc. or any custom numeric type.
+    template <typename T = int>
+    constexpr T to_number() const
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return to_double();
+            }
+        }
+
+        T result = 0;
+        for (const auto& chunk : chunks_ | std::views::reverse)
+        {
+            result = result * BASE + chunk;
+        }
+        return result * sign_;
+    }
+
+    /// Convert the integer to the nearest double (ties to even), like Python's `float(int)`.
+    /// Usually only the most significant 3 chunks are examined, so it is fast for big integers.
+    /// If the integer is too large to convert, throw a `runtime_error`.
+    double to_double() const
+    {
+        if (is_zero())
+        {
+            return 0.0;
+        }
+
+        // this.abs = top * 10^exp + rest, 0 <= rest < 10^exp, the top chunks have at least 19 digits if rest exists
+        const int top = std::min<int>(chunks_.size(), 3);
+        const int exp = (chunks_.size() - top) * DIGITS_PER_CHUNK;
+        const bool sticky = std::any_of(chunks_.begin(), chunks_.end() - top, [](int chunk)
+                                        { return chunk != 0; });
+
+        // "0" + digits of top + "e" + exp, the leading zero makes room for the carry of top + 1
+        char buffer[1 + 3 * DIGITS_PER_CHUNK + 8] = {'0'};
+        char* digits_end = buffer + 1;
+        for (int i = chunks_.size() - 1; i >= int(chunks_.size()) - top; --i)
+        {
+            write_chunk(chunks_[i], digits_end);
+            digits_end += DIGITS_PER_CHUNK;
+        }
+        *digits_end = 'e';
+        char* end = std::to_chars(digits_end + 1, buffer + sizeof(buffer), exp).ptr;
+
+        // correctly rounded by std::from_chars, out of range means overflow
+        auto parse = [&]()
+        {
+            double value;
+            return std::from_chars(buffer, end, value).ec == std::errc() ? value : HUGE_VAL;
+        };
+
+        // round(top * 10^exp) <= round(this.abs) <= round((top + 1) * 10^exp)
+        double result = parse();
+        if (sticky && result != HUGE_VAL)
+        {
+            char* it = digits_end - 1;
+            for (; *it == '9'; --it)
+            {
+                *it = '0';
+            }
+            ++*it;
+
+            // near a rounding boundary (rare), round exactly: keep 62 bits or more, and a sticky bit below them
+            if (parse() != result)
+            {
+                const int shift = std::max(std::ilogb(result) - 62, 0);
+                auto [q, r] = abs().divmod(pow(2, shift));
+                result = std::ldexp(double(q.to_number<unsigned long long>() | !r.is_zero()), shift);
+            }
+        }
+
+        if (result == HUGE_VAL)
+        {
+            throw std::runtime_error("Error: Integer too large to convert to double.");
+        }
+
+        return result * sign_;
+    }
+
+    /// Convert the integer to decimal characters in the range [`first`, `last`) without allocation, like `std::to_chars`.
+    /// On success, return the pointer past the last written character and `std::errc()`.
+    /// If the range is too small, return `last` and `std::errc::value_too_large`.
+    ///
+    /// ### Example
+    /// ```
+    /// char buffer[32];
+    /// auto [ptr, ec] = Int("-18446744073709551617").to_chars(buffer, buffer + 32);
+    /// std::string_view(buffer, ptr); // "-18446744073709551617"
+    /// ```
+    constexpr std::to_chars_result to_chars(char* first, char* last) const
+    {
+        // exact size
+        const int size = is_zero() ? 1 : digits() + is_negative();
+        if (last - first < size)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        if (is_zero())
+        {
+            *first = '0';
+            return {first + 1, std::errc()};
+        }
+
+        if (is_negative())
+        {
+            *first++ = '-';
+        }
+
+        // most significant chunk without leading zeros
+        char buffer[DIGITS_PER_CHUNK];
+        write_chunk(chunks_.back(), buffer);
+        first = std::copy(buffer + DIGITS_PER_CHUNK - chunk_digits(chunks_.back()), buffer + DIGITS_PER_CHUNK, first);
+
+        for (int i = chunks_.size() - 2; i >= 0; --i)
+        {
+            write_chunk(chunks_[i], first);
+            first += DIGITS_PER_CHUNK;
+        }
+
+        return {first, std::errc()};
+    }
+
+    /// Return the string representation of the integer based on 2-36 `base` (default = 10).
+    /// Digits greater than 9 are lowercase letters 'a'-'z'.
+    ///
+    /// ### Example
+    /// ```
+    /// Int("-18446744073709551615").to_string(16); // "-ffffffffffffffff"
+    /// Int(35).to_string(36); // "z"
+    /// ```
+    std::string to_string(int base = 10) const
+    {
+        if (base < 2 || base > 36)
+        {
+            throw std::runtime_error("Error: Invalid base for to_string().");
+        }
+
+        if (is_zero())
+        {
+            return "0";
+        }
+
+        std::string str = is_negative() ? "-" : "";
+        if (base == 10)
+        {
+            str.resize(digits() + is_negative());
+            to_chars(str.data(), str.data() + str.size());
+        }
+        else
+        {
+            write_digits(abs(), base, 0, str);
+        }
+
+        return str;
+    }
+
+    /// Return an array of bytes representing the integer, like Python's `int.to_bytes()`.
+    /// The integer is represented using exactly `length` bytes in the byte `order` (default = big endian).
+    /// If `is_signed` is false (default) and the integer is negative, or the integer is not representable, throw a `runtime_error`.
+    ///
+    /// ### Example
+    /// ```
+    /// Int(1024).to_bytes(2); // {0x04, 0x00}
+    /// Int(-1024).to_bytes(4, std::endian::little, true); // {0x00, 0xfc, 0xff, 0xff}
+    /// ```
+    std::vector<unsigned char> to_bytes(int length, std::endian order = std::endian::big, bool is_signed = false) const
+    {
+        if (is_negative() && !is_signed)
+        {
+            throw std::runtime_error("Error: Can't convert negative integer to unsigned.");
+        }
+
+        // two's complement
+        Int n = is_negative() ? *this + pow(256, length) : *this;
+        std::string hex = n.is_positive() ? n.to_string(16) : "";
+
+        const bool top_bit = hex.size() == length * 2 && digit_value(hex[0]) >= 8;
+        if (n.is_negative() || hex.size() > length * 2 || (is_signed && top_bit != is_negative()))
+        {
+            throw std::runtime_error("Error: Integer too big to convert.");
+        }
+
+        hex.insert(0, length * 2 - hex.size(), '0');
+        std::vector<unsigned char> bytes(length);
+        for (int i = 0; i < length; ++i)
+        {
+            bytes[i] = digit_value(hex[i * 2]) * 16 + digit_value(hex[i * 2 + 1]);
+        }
+        if (order == std::endian::little)
+        {
+            std::reverse(bytes.begin(), bytes.end());
+        }
+
+        return bytes;
+    }
+
+    /// Dump the integer to the output stream `os` in raw chunk format, much faster and smaller than decimal text.
+    /// Format: sign (1 byte), number of chunks (8 bytes), chunks (4 bytes each, little endian first), all in native byte order.
+    void dump(std::ostream& os) const
+    {
+        const std::int8_t sign = sign_;
+        const std::uint64_t size = chunks_.size();
+        os.write(reinterpret_cast<const char*>(&sign), sizeof(sign));
+        os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        os.write(reinterpret_cast<const char*>(chunks_.data()), size * sizeof(int));
+    }
+
+    /*
+     * Static
+     */
+
+    /// Parse an integer based on 2-36 `base` (default = 10) from the characters in the range [`first`, `last`), like `std::from_chars`.
+    /// An optional leading '-' is accepted, digits greater than 9 are 'a'-'z' or 'A'-'Z'.
+    /// On success, store the integer in `value`, return the pointer past the last parsed character and `std::errc()`.
+    /// If there is no digit, return `first` and `std::errc::invalid_argument`, and `value` is unmodified.
+    ///
+    /// ### Example
+    /// ```
+    /// std::string_view str = "-ffffffffffffffff!";
+    /// Int n;
+    /// auto [ptr, ec] = Int::from_chars(str.data(), str.data() + str.size(), n, 16); // n == -18446744073709551615, *ptr == '!'
+    /// ```
+    static std::from_chars_result from_chars(const char* first, const char* last, Int& value, int base = 10)
+    {
+        if (base < 2 || base > 36)
+        {
+            throw std::runtime_error("Error: Invalid base for from_chars().");
+        }
+
+        const bool negative = first != last && *first == '-';
+        const char* digits = first + negative;
+        const char* it = digits;
+        while (it != last && digit_value(*it) < base)
+        {
+            ++it;
+        }
+        if (it == digits)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        Int result;
+        if (base == 10)
+        {
+            result.parse_decimal(digits, it);
+        }
+        else
+        {
+            result = parse_digits(digits, it, base);
+        }
+        if (negative)
+        {
+            result.sign_ = -result.sign_;
+        }
+        value = std::move(result);
+
+        return {it, std::errc()};
+    }
+
+    /// Return the integer represented by the array of `bytes`, like Python's `int.from_bytes()`.
+    /// The `bytes` are in the byte `order` (default = big endian), and in two's complement if `is_signed` (default = false).
+    ///
+    /// ### Example
+    /// ```
+    /// Int::from_bytes({0x04, 0x00}); // 1024
+    /// Int::from_bytes({0x00, 0xfc, 0xff, 0xff}, std::endian::little, true); // -1024
+    /// ```
+    static Int from_bytes(const std::vector<unsigned char>& bytes, std::endian order = std::endian::big, bool is_signed = false)
+    {
+        std::string hex(bytes.size() * 2, '0');
+        for (int i = 0; i < bytes.size(); ++i)
+        {
+            int j = order == std::endian::big ? i : bytes.size() - 1 - i;
+            hex[j * 2] = "0123456789abcdef"[bytes[i] >> 4];
+            hex[j * 2 + 1] = "0123456789abcdef"[bytes[i] & 0xf];
+        }
+
+        Int n;
+        from_chars(hex.data(), hex.data() + hex.size(), n, 16);
+
+        // two's complement
+        if (is_signed && !hex.empty() && digit_value(hex[0]) >= 8)
+        {
+            n -= pow(256, int(bytes.size()));
+        }
+
+        return n;
+    }
+
+    /// Load an integer dumped by `dump()` from the memory in the range [`first`, `last`), such as a memory-mapped file.
+    /// Store the integer in `value` with a single copy of the chunks, return the pointer past the loaded data.
+    /// If the data is invalid, throw a `runtime_error`.
+    static const char* load(const char* first, const char* last, Int& value)
+    {
+        std::int8_t sign;
+        std::uint64_t size;
+        if (last - first < sizeof(sign) + sizeof(size))
+        {
+            throw std::runtime_error("Error: Invalid raw integer data.");
+        }
+        std::memcpy(&sign, first, sizeof(sign));
+        std::memcpy(&size, first + sizeof(sign), sizeof(size));
+        first += sizeof(sign) + sizeof(size);
+        if ((last - first) / sizeof(int) < size)
+        {
+            throw std::runtime_error("Error: Invalid raw integer data.");
+        }
+
+        Int n;
+        n.chunks_.resize(size);
+        std::memcpy(n.chunks_.data(), first, size * sizeof(int));
+        n.sign_ = sign;
+
+        // check the sign and chunks
+        const bool valid_sign = size == 0 ? sign == 0 : (sign == 1 || sign == -1) && n.chunks_.back() != 0;
+        if (!valid_sign || std::any_of(n.chunks_.begin(), n.chunks_.end(), [](int c)
+                                       { return c < 0 || c >= BASE; }))
+        {
+            throw std::runtime_error("Error: Invalid raw integer data.");
+        }
+
+        value = std::move(n);
+        return first + size * sizeof(int);
+    }
+
+    /// Load an integer dumped by `dump()` from the input stream `is`.
+    /// If the data is invalid, throw a `runtime_error`.
+    static Int load(std::istream& is)
+    {
+        char header[sizeof(std::int8_t) + sizeof(std::uint64_t)];
+        is.read(header, sizeof(header));
+
+        std::uint64_t size = 0;
+        std::memcpy(&size, header + sizeof(std::int8_t), sizeof(size));
+        std::string data(header, header + is.gcount());
+        if (is.gcount() == sizeof(header) && size <= std::numeric_limits<int>::max())
+        {
+            data.resize(sizeof(header) + size * sizeof(int));
+            is.read(data.data() + sizeof(header), size * sizeof(int));
+            data.resize(sizeof(header) + is.gcount());
+        }
+
+        Int n;
+        load(data.data(), data.data() + data.size(), n);
+        return n;
+    }
+
+    /// Return the square root of integer `n`.
+    static constexpr Int sqrt(const Int& n)
+    {
+        if (n.sign_ == -1)
+        {
+            throw std::runtime_error("Error: Require n >= 0 for sqrt(n).");
+        }
+
+        // binary search
+        Int lo = 0, hi = n, res;
+        while (lo <= hi)
+        {
+            Int mid = lo + (hi - lo) / 2;
+
+            if (mid * mid <= n) // if mid^2 <= n, update the result and search in upper half
+            {
+                res = mid;
+                lo = mid + 1;
+            }
+            else // else mid^2 > n, search in the lower half
+            {
+                hi = mid - 1;
+            }
+        }
+
+        return res;
+    }
+
+    /// Return `(base**exp) % mod` (`mod` default = 0 means does not perform module).
+    static constexpr Int pow(const Int& base, const Int& exp, const Int& mod = 0)
+    {
+        // if base.abs is 1, only when base is negative and exp is odd return -1, otherwise return 1
+        if (base.chunks_.size() == 1 && base.chunks_[0] == 1)
+        {
+            return base.sign_ == -1 && exp.is_odd() ? -1 : 1;
+        }
+
+        // then, check if exp is negative
+        if (exp.is_negative())
+        {
+            if (base.is_zero())
+            {
+                throw std::runtime_error("Error: Math domain error.");
+            }
+
+            return 0;
+        }
+
+        // fast power algorithm
+        Int num = base, n = exp, res = 1;
+        while (!n.is_zero())
+        {
+            if (n.is_odd())
+            {
+                res *= num;
+                if (!mod.is_zero())
+                {
+                    res %= mod;
+                }
+            }
+            num *= num;
+            if (!mod.is_zero())
+            {
+                num %= mod;
+            }
+            n.small_div(2);
+        }
+
+        return res;
+    }
+
+    /// Return the logarithm of integer `n` based on integer `base`.
+    static constexpr Int log(const Int& n, const Int& base)
+    {
+        if (n.sign_ <= 0 || base < 2)
+        {
+            throw std::runtime_error("Error: Math domain error.");
+        }
+
+        if (base == 10) // log10 == digits-1
+        {
+            return n.digits() - 1;
+        }
+
+        Int num = n / base, res;
+        while (!num.is_zero())
+        {
+            ++res;
+            num /= base;
+        }
+
+        return res;
+    }
+
+    /// Calculate the greatest common divisor of two integers.
+    static constexpr Int gcd(const Int& a, const Int& b)
+    {
+        return detail::gcd(a, b);
+    }
+
+    /// Calculate the least common multiple of two integers.
+    static constexpr Int lcm(const Int& a, const Int& b)
+    {
+        if (a.is_zero() || b.is_zero())
+        {
+            return 0;
+        }
+
+        return (a * b).abs() / gcd(a, b); // LCM = |a * b| / GCD
+    }
+
+    /// Generate a random integer in [`a`, `b`].
+    ///
+    /// ### Example
+    /// ```
+    /// random(0, 9); // x in [0, 9]
+    /// random(1, 6); // x in [1, 6]
+    /// ```
+    static Int random(const Int& a, const Int& b)
+    {
+        if (b < a)
+        {
+            throw std::runtime_error("Error: Require a >= b for random(a, b).");
+        }
+
+        std::mt19937 gen(std::random_device{}());
+        std::uniform_real_distribution<long double> dis(0.0, 1.0); // [0, 1)
+
+        return Int((long long)(dis(gen) * (b - a + 1).to_number<long double>())) + a; // [a, b]
+    }
+
+    /// Generate a random integer of a specified number of `digits`.
+    ///
+    /// ### Example
+    /// ```
+    /// random(1); // x in [1, 9]
+    /// random(3); // x in [100, 999]
+    /// ```
+    static Int random(int digits)
+    {
+        if (digits <= 0)
+        {
+            throw std::runtime_error("Error: Require digits > 0 for random(digits).");
+        }
+
+        // random number generator
+        std::mt19937 gen(std::random_device{}());
+
+        // little chunks
+        auto chunks = Chunks((digits - 1) / DIGITS_PER_CHUNK);
+        std::uniform_int_distribution<int> chunk(0, BASE - 1);
+        std::for_each(chunks.begin(), chunks.end(), [&](auto& x)
+                      { x = chunk(gen); });
+
+        // most significant chunk
+        int n = (digits - 1) % DIGITS_PER_CHUNK + 1;
+        std::uniform_int_distribution<int> most_chunk(std::pow(10, n - 1), std::pow(10, n) - 1);
+        chunks.push_back(most_chunk(gen));
+
+        return Int(1, chunks);
+    }
+
+    /// Calculate the `n`th term of the Fibonacci sequence: 0 (n=0), 1, 1, 2, 3, 5, ...
+    static constexpr Int fibonacci(const Int& n)
+    {
+        if (n.is_negative())
+        {
+            throw std::runtime_error("Error: Require n >= 0 for fibonacci(n).");
+        }
+
+        // ref: https://sicp-solutions.net/post/sicp-solution-exercise-1-19
+
+        // T_pq(a, b) = (bq + aq + ap, bp + aq)
+        // T_pq(T_pq(a, b)) = ((bp+aq)q + (bq+aq+ap)q + (bq+aq+ap)p, (bp+aq)p + (bq+aq+ap)q)
+        //                  = (b(2pq+q^2) + a(p^2+q^2) + a(2pq+q^2), b(p^2+q^2) + a(2pq+q^2))
+        //                  = T_p'q'(a, b)
+        // => p' = p^2 + q^2, q' = 2pq + q^2
+
+        Int a = 1, b = 0, p = 0, q = 1, cnt = n;
+        while (!cnt.is_zero())
+        {
+            if (cnt.is_even())
+            {
+                Int p_ = p * p + q * q;
+                Int q_ = p * q * 2 + q * q;
+                p = p_;
+                q = q_;
+                cnt.small_div(2);
+            }
+            else
+            {
+                Int a_ = b * q + a * (p + q);
+                Int b_ = b * p + a * q;
+                a = a_;
+                b = b_;
+                cnt.abs_dec();
+            }
+        }
+        return b;
+    }
+
+    /// The well-known Ackermann function (perhaps not so well-known) is a rapidly growing function.
+    /// Please input parameters carefully.
+    /// See: https://en.wikipedia.org/wiki/Ackermann_function
+    static Int ackermann(const Int& m, const Int& n)
+    {
+        if (m.is_negative() || n.is_negative())
+        {
+            throw std::runtime_error("Error: Require m >= 0 and n >= 0 for ackermann(m, n).");
+        }
+
+        // A(m, n) = H_m(2, n + 3) - 3, evaluated without recursion
+        // ref: https://en.wikipedia.org/wiki/Ackermann_function#Definition
+        return hyperoperation(m, 2, n + 3) - 3;
+    }
+
+    /// The hyperoperation sequence is an infinite sequence of arithmetic operations.
+    /// This sequence starts with unary successor (n = 0), continues with addition (n = 1), multiplication (n = 2), exponentiation (n = 3), etc.
+    /// See: https://en.wikipedia.org/wiki/Hyperoperation
+    static Int hyperoperation(const Int& n, const Int& a, const Int& b)
+    {
+        if (n.is_negative() || a.is_negative() || b.is_negative())
+        {
+            throw std::runtime_error("Error: Require n >= 0 and a >= 0 and b >= 0 for hyperoperation(n, a, b).");
+        }
+
+        // special cases
+        if (n > 3)
+        {
+            if (a.is_zero() && b.is_even())
+            {
+                return 1;
+            }
+            else if (a.is_zero() && b.is_odd())
+            {
+                return 0;
+            }
+            else if (a == 1 || b.is_zero())
+            {
+                return 1;
+            }
+            else if (b == 1)
+            {
+                return a;
+            }
+            else if (a == 2 && b == 2)
+            {
+                return 4;
+            }
+        }
+
+        // now, if n > 3 then a >= 2 and b >= 2 and not a == b == 2
+        // H_6(2, 3) = H_5(2, 4) = 2^^65536 and H_6(3, 2) = H_5(3, 3) = 3^^7625597484987, so H_n(a, b) for n >= 6 is too large
+        if (n > 5)
+        {
+            throw std::runtime_error("Error: The result is too large to compute.");
+        }
+
+        switch (n.to_number())
+        {
+            case 0:
+                return Int(1) + b;
+            case 1:
+                return a + b;
+            case 2:
+                return a * b;
+            case 3:
+                return Int::pow(a, b);
+            case 4:
+                return tetration(a, b);
+            default: // H_5(a, b) = H_4(a, H_5(a, b - 1)), H_5(a, 1) = a
+            {
+                Int result = a;
+                for (Int i = 1; i < b; ++i)
+                {
+                    result = tetration(a, result);
+                }
+                return result;
+            }
+        }
+    }
+
+    /// Set the maximum number of `threads` used by the multiplication of huge integers (default = 1, serial).
+    /// Only the sub-products of operands with more than about ten thousand digits are computed in parallel.
+    static void set_threads(int threads)
+    {
+        if (threads < 1)
+        {
+            throw std::runtime_error("Error: Require threads >= 1 for set_threads(threads).");
+        }
+
+        threads_ = threads;
+    }
+
+    /*
+     * Memory
+     */
+
+    /// Allocate the chunks of all integers created by the current thread in this scope from the given memory `resource`.
+    /// Integers created in the scope must not be used after the `resource` is released,
+    /// assign them to integers created outside the scope to keep the values.
+    /// Scopes can be nested, the previous resource is restored when the scope ends.
+    class Scope
+    {
+    private:
+        // Resource of the outer scope.
+        std::pmr::memory_resource* previous_;
+
+    public:
+        /// Enter the scope of memory `resource`.
+        explicit Scope(std::pmr::memory_resource* resource)
+            : previous_(detail::current_resource)
+        {
+            detail::current_resource = resource;
+        }
+
+        /// Leave the scope.
+        ~Scope()
+        {
+            detail::current_resource = previous_;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    /// Thread-local size-class pool of chunks, freed chunks are reused without going back to the global heap.
+    class Pool
+    {
+    private:
+        // Pool resource, not synchronized since it is only used by the current thread.
+        std::pmr::unsynchronized_pool_resource resource_;
+
+        // Scope of the pool resource.
+        Scope scope_;
+
+    public:
+        /// Enter the scope of a new pool.
+        Pool()
+            : scope_(&resource_)
+        {
+        }
+    };
+
+    /// Arena of chunks, all chunks are allocated linearly and released at once when the arena is destroyed.
+    ///
+    /// ### Example
+    /// ```
+    /// Int result;
+    /// {
+    ///     Int::Arena arena;
+    ///     result = Int(1000).factorial(); // copy the value out of the arena
+    /// }
+    /// ```
+    class Arena
+    {
+    private:
+        // Monotonic resource.
+        std::pmr::monotonic_buffer_resource resource_;
+
+        // Scope of the monotonic resource.
+        Scope scope_;
+
+    public:
+        /// Enter the scope of a new arena.
+        Arena()
+            : scope_(&resource_)
+        {
+        }
+
+        /// Enter the scope of a new arena, reserve `size` bytes first.
+        explicit Arena(std::size_t size)
+            : resource_(size)
+            , scope_(&resource_)
+        {
+        }
+    };
+
+    /*
+     * Print / Input
+     */
+
+    /// Output the integer to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const Int& integer)
+    {
+        if (integer.sign_ == 0)
+        {
+            return os << '0';
+        }
+
+        if (integer.sign_ == -1)
+        {
+            os << '-';
+        }
+
+        char buffer[DIGITS_PER_CHUNK];
+        Int::write_chunk(integer.chunks_.back(), buffer);
+        const int n = Int::chunk_digits(integer.chunks_.back());
+        os.write(buffer + DIGITS_PER_CHUNK - n, n);
+
+        for (int i = integer.chunks_.size() - 2; i >= 0; --i)
+        {
+            Int::write_chunk(integer.chunks_[i], buffer);
+            os.write(buffer, DIGITS_PER_CHUNK);
+        }
+
+        return os;
+    }
+
+    /// Get an integer from the specified input stream.
+    friend std::istream& operator>>(std::istream& is, Int& integer)
+    {
+        std::string str;
+        is >> str;
+        integer = str.c_str();
+
+        return is;
+    }
+
+    friend struct std::hash<pyincpp::Int>;
+
+    friend class ModContext;
+    friend class ModInt;
+
+#ifdef __cpp_lib_format
+    friend struct std::formatter<pyincpp::Int>;
+#endif
+};
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::Int> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::Int& integer) const
+    {
+        return pyincpp::detail::hash_bytes(integer.chunks_.data(), integer.chunks_.size() * sizeof(int), integer.sign_);
+    }
+};
+
+#ifdef __cpp_lib_format
+template <>
+struct std::formatter<pyincpp::Int> // explicit specialization
+{
+    // Presentation type: 'd' (default), 'b', 'o', 'x' or 'X'.
+    char type_ = 'd';
+
+    constexpr auto parse(std::format_parse_context& ctx)
+    {
+        auto it = ctx.begin();
+        if (it != ctx.end() && (*it == 'd' || *it == 'b' || *it == 'o' || *it == 'x' || *it == 'X'))
+        {
+            type_ = *it++;
+        }
+        if (it != ctx.end() && *it != '}')
+        {
+            throw std::format_error("Error: Invalid format specifier for Int.");
+        }
+        return it;
+    }
+
+    auto format(const pyincpp::Int& integer, std::format_context& ctx) const
+    {
+        auto out = ctx.out();
+
+        if (type_ != 'd')
+        {
+            std::string str = integer.to_string(type_ == 'b' ? 2 : (type_ == 'o' ? 8 : 16));
+            if (type_ == 'X')
+            {
+                std::transform(str.begin(), str.end(), str.begin(), [](char c)
+                               { return c >= 'a' && c <= 'z' ? c & 0b1101'1111 : c; });
+            }
+            return std::copy(str.begin(), str.end(), out);
+        }
+
+        if (integer.is_zero())
+        {
+            *out++ = '0';
+            return out;
+        }
+
+        if (integer.is_negative())
+        {
+            *out++ = '-';
+        }
+
+        // chunk by chunk, no temporary string
+        constexpr int n = pyincpp::Int::DIGITS_PER_CHUNK;
+        char buffer[n];
+        pyincpp::Int::write_chunk(integer.chunks_.back(), buffer);
+        out = std::copy(buffer + n - pyincpp::Int::chunk_digits(integer.chunks_.back()), buffer + n, out);
+
+        for (int i = integer.chunks_.size() - 2; i >= 0; --i)
+        {
+            pyincpp::Int::write_chunk(integer.chunks_[i], buffer);
+            out = std::copy(buffer, buffer + n, out);
+        }
+
+        return out;
+    }
+};
+#endif
+
+#endif // INT_HPP
@@ -0,0 +1,377 @@
+//! @file mod_int.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief ModContext and ModInt classes.
+//! @date 2026.10.17
+
+#ifndef MOD_INT_HPP
+#define MOD_INT_HPP
+
+#include "int.hpp"
+#include "list.hpp"
+
+namespace pyincpp
+{
+
+class ModInt;
+
+/// ModContext holds a modulus and the constants precomputed for it, shared by all ModInt values of the modulus.
+/// If the modulus is coprime with 10, values are kept in Montgomery form, so multiplication needs no division.
+class ModContext
+{
+private:
+    // Modulus.
+    Int mod_;
+
+    // -mod^(-1) mod base of chunk, or 0 if Montgomery form is not used.
+    int inv_;
+
+    // R^2 mod mod, R = base^mod.len, converts a value into Montgomery form.
+    Int r2_;
+
+    // Convert `value` in [0, mod) to the internal form.
+    Int to_form(const Int& value) const
+    {
+        return inv_ ? Int::mul_montgomery(value, r2_, mod_, inv_) : value;
+    }
+
+    // Convert `value` from the internal form back to [0, mod).
+    Int from_form(const Int& value) const
+    {
+        return inv_ ? Int::mul_montgomery(value, 1, mod_, inv_) : value;
+    }
+
+    // Multiply two values in the internal form.
+    Int mul(const Int& a, const Int& b) const
+    {
+        return inv_ ? Int::mul_montgomery(a, b, mod_, inv_) : a * b % mod_;
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create a context of the modulus `mod`.
+    /// If `mod` <= 0, throw a `runtime_error`.
+    explicit ModContext(const Int& mod)
+        : mod_(mod)
+        , inv_(0)
+    {
+        if (!mod.is_positive())
+        {
+            throw std::runtime_error("Error: Require mod > 0 for ModContext(mod).");
+        }
+
+        // Montgomery form requires that the modulus is coprime with the base of chunk (10^9)
+        if (mod.is_odd() && mod.chunks_[0] % 5 != 0)
+        {
+            inv_ = Int::montgomery_inverse(mod.chunks_[0]);
+            r2_ = Int::pow(10, Int::DIGITS_PER_CHUNK * 2 * mod.chunks_.size(), mod);
+        }
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the modulus.
+    const Int& mod() const
+    {
+        return mod_;
+    }
+
+    /// Determine whether the values are kept in Montgomery form.
+    bool is_montgomery() const
+    {
+        return inv_ != 0;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the inverses of all `values` with one modular inversion and 3(N-1) multiplications (Montgomery's trick).
+    /// If any value is not invertible, throw a `runtime_error`.
+    List<ModInt> batch_inverse(const List<ModInt>& values) const;
+
+    /*
+     * Static
+     */
+
+    /// Return the smallest non-negative `x` that `x % moduli[i] == remainders[i]` for all `i` (Chinese remainder theorem).
+    /// The moduli need not be pairwise coprime, and the result is less than their least common multiple.
+    /// If there is no solution, throw a `runtime_error`.
+    ///
+    /// ### Example
+    /// ```
+    /// ModContext::crt({2, 3, 2}, {3, 5, 7}); // 23
+    /// ```
+    static Int crt(const List<Int>& remainders, const List<Int>& moduli)
+    {
+        if (remainders.size() != moduli.size())
+        {
+            throw std::runtime_error("Error: Require remainders.size() == moduli.size() for crt(remainders, moduli).");
+        }
+
+        // combine the congruences one by one: x == r (mod m)
+        Int r = 0, m = 1;
+        for (int i = 0; i < moduli.size(); ++i)
+        {
+            if (!moduli[i].is_positive())
+            {
+                throw std::runtime_error("Error: Require moduli > 0 for crt(remainders, moduli).");
+            }
+
+            // x = r + m * k, m * k == r_i - r (mod m_i), solvable iff gcd(m, m_i) | r_i - r
+            const Int g = Int::gcd(m, moduli[i]);
+            auto [q, rem] = (remainders[i] - r).divmod(g);
+            if (!rem.is_zero())
+            {
+                throw std::runtime_error("Error: No solution for crt(remainders, moduli).");
+            }
+
+            const Int mi = moduli[i] / g;
+            Int k = q * Int::inverse_mod(m / g % mi, mi) % mi;
+            if (k.is_negative())
+            {
+                k += mi;
+            }
+            r += m * k;
+            m *= mi;
+        }
+
+        return r;
+    }
+
+    friend class ModInt;
+};
+
+/// ModInt is an integer modulo the modulus of a ModContext, the context must outlive it.
+class ModInt
+{
+private:
+    // Context of the modulus.
+    const ModContext* context_;
+
+    // Value in the internal form of the context, in [0, mod).
+    Int value_;
+
+    // Helper constructor, `value` is in the internal form.
+    ModInt(const ModContext* context, Int value)
+        : context_(context)
+        , value_(std::move(value))
+    {
+    }
+
+    // Check whether two values have the same modulus.
+    void check_context(const ModInt& that) const
+    {
+        if (context_ != that.context_ && context_->mod_ != that.context_->mod_)
+        {
+            throw std::runtime_error("Error: The modulus of two values are different.");
+        }
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create the value `value % context.mod()` (default = 0).
+    explicit ModInt(const ModContext& context, const Int& value = 0)
+        : context_(&context)
+    {
+        Int r = value % context.mod_;
+        value_ = context.to_form(r.is_negative() ? r + context.mod_ : r);
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this value is equal to another value.
+    bool operator==(const ModInt& that) const
+    {
+        check_context(that);
+
+        return value_ == that.value_;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the value in [0, mod).
+    Int value() const
+    {
+        return context_->from_form(value_);
+    }
+
+    /// Return the context.
+    const ModContext& context() const
+    {
+        return *context_;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return this += `rhs`.
+    ModInt& operator+=(const ModInt& rhs)
+    {
+        check_context(rhs);
+
+        value_ += rhs.value_;
+        if (value_ >= context_->mod_)
+        {
+            value_ -= context_->mod_;
+        }
+        return *this;
+    }
+
+    /// Return this -= `rhs`.
+    ModInt& operator-=(const ModInt& rhs)
+    {
+        check_context(rhs);
+
+        value_ -= rhs.value_;
+        if (value_.is_negative())
+        {
+            value_ += context_->mod_;
+        }
+        return *this;
+    }
+
+    /// Return this *= `rhs`.
+    ModInt& operator*=(const ModInt& rhs)
+    {
+        check_context(rhs);
+
+        value_ = context_->mul(value_, rhs.value_);
+        return *this;
+    }
+
+    /// Return this /= `rhs`.
+    /// If `rhs` is not invertible, throw a `runtime_error`.
+    ModInt& operator/=(const ModInt& rhs)
+    {
+        return *this *= rhs.inverse();
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the opposite value of this.
+    ModInt operator-() const
+    {
+        return ModInt(context_, value_.is_zero() ? value_ : context_->mod_ - value_);
+    }
+
+    /// Return this + `rhs`.
+    ModInt operator+(const ModInt& rhs) const
+    {
+        return ModInt(*this) += rhs;
+    }
+
+    /// Return this - `rhs`.
+    ModInt operator-(const ModInt& rhs) const
+    {
+        return ModInt(*this) -= rhs;
+    }
+
+    /// Return this * `rhs`.
+    ModInt operator*(const ModInt& rhs) const
+    {
+        return ModInt(*this) *= rhs;
+    }
+
+    /// Return this / `rhs`.
+    /// If `rhs` is not invertible, throw a `runtime_error`.
+    ModInt operator/(const ModInt& rhs) const
+    {
+        return ModInt(*this) /= rhs;
+    }
+
+    /// Return the multiplicative inverse of this.
+    /// If this is not invertible, throw a `runtime_error`.
+    ModInt inverse() const
+    {
+        const Int& mod = context_->mod_;
+        Int inv = Int::inverse_mod(value(), mod);
+        if (inv.is_zero() && mod != 1)
+        {
+            throw std::runtime_error("Error: The value is not invertible.");
+        }
+        return ModInt(context_, context_->to_form(inv));
+    }
+
+    /// Return this**`exp`, a negative `exp` means the power of the inverse.
+    ModInt pow(const Int& exp) const
+    {
+        if (exp.is_negative())
+        {
+            return inverse().pow(-exp);
+        }
+
+        // fast power algorithm
+        ModInt num = *this, res(*context_, 1);
+        Int n = exp;
+        while (!n.is_zero())
+        {
+            if (n.is_odd())
+            {
+                res *= num;
+            }
+            num *= num;
+            n /= 2;
+        }
+
+        return res;
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the value to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const ModInt& value)
+    {
+        return os << value.value();
+    }
+
+    friend class ModContext;
+};
+
+inline List<ModInt> ModContext::batch_inverse(const List<ModInt>& values) const
+{
+    if (values.size() == 0)
+    {
+        return {};
+    }
+
+    // prefix[i] = values[0] * ... * values[i]
+    List<ModInt> prefix;
+    prefix += values[0];
+    for (int i = 1; i < values.size(); ++i)
+    {
+        prefix += prefix[i - 1] * values[i];
+    }
+
+    // walk back from the inverse of the whole product
+    ModInt inv = prefix[values.size() - 1].inverse();
+    List<ModInt> result = values;
+    for (int i = values.size() - 1; i > 0; --i)
+    {
+        result[i] = inv * prefix[i - 1];
+        inv *= values[i];
+    }
+    result[0] = inv;
+
+    return result;
+}
+
+} // namespace pyincpp
+
+#endif // MOD_INT_HPP
@@ -1,764 +1,742 @@
-//! @file str.hpp
-//! @author Chen QingYu <chen_qingyu@qq.com>
-//! @brief Str class.
-//! @date 2023.01.08
-
-#ifndef STR_HPP
-#define STR_HPP
-
-#include "detail.hpp"
-
-#include "int.hpp"
-#include "list.hpp"
-
-namespace pyincpp
-{
-
-/// Str is immutable sequence of characters.
-class Str
-{
-private:
-    // String.
-    const std::string str_;
-
-    // Used for FSM.
-    enum state
-    {
-        S_START = 1 << 0,    // start with blank character
-        S_SIGN = 1 << 1,     // positive or negative sign
-        S_INT = 1 << 2,      // integer part
-        S_POINT = 1 << 3,    // decimal point that doesn't have left digit
-        S_DEC = 1 << 4,      // decimal part
-        S_EXP = 1 << 5,      // scientific notation identifier
-        S_EXP_SIGN = 1 << 6, // positive or negative sign of exponent part
-        S_EXP_NUM = 1 << 7,  // exponent part number
-        S_END = 1 << 8,      // end with blank character
-        S_OTHER = 1 << 9,    // other
-    };
-
-    // Used for FSM.
-    enum event
-    {
-        E_BLANK = 1 << 10, // blank character: ' ', '\n', '\t', '\r'
-        E_SIGN = 1 << 11,  // positive or negative sign: '+', '-'
-        E_DIGIT = 1 << 12, // 36-based digit: '[0-9a-zA-Z]'
-        E_POINT = 1 << 13, // decimal point: '.'
-        E_EXP = 1 << 14,   // scientific notation identifier: 'e', 'E'
-        E_OTHER = 1 << 15, // other
-    };
-
-    // Try to transform a character to an event.
-    static event get_event(const char ch, const int base)
-    {
-        if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r')
-        {
-            return E_BLANK;
-        }
-        else if (ch == '+' || ch == '-')
-        {
-            return E_SIGN;
-        }
-        else if (char_to_integer(ch, base) != -1)
-        {
-            return E_DIGIT;
-        }
-        else if (ch == '.')
-        {
-            return E_POINT;
-        }
-        else if (ch == 'e' || ch == 'E')
-        {
-            return E_EXP;
-        }
-        return E_OTHER;
-    }
-
-    // Try to transform a character to an integer based on 2-36 base.
-    static int char_to_integer(char digit, int base) // 2 <= base <= 36
-    {
-        static const char* upper_digits = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-        static const char* lower_digits = "0123456789abcdefghijklmnopqrstuvwxyz";
-        for (int i = 0; i < base; ++i)
-        {
-            if (digit == upper_digits[i] || digit == lower_digits[i])
-            {
-                return i;
-            }
-        }
-        return -1; // not an integer
-    }
-
-    // Format helper, see https://codereview.stackexchange.com/questions/269425/implementing-stdformat
-    template <typename T>
-    static void format_helper(std::ostringstream& oss, std::string_view& str, const T& value)
-    {
-        std::size_t open_bracket = str.find('{');
-        std::size_t close_bracket = str.find('}', open_bracket + 1);
-        if (open_bracket == std::string::npos || close_bracket == std::string::npos)
-        {
-            return;
-        }
-        oss << str.substr(0, open_bracket) << value;
-        str = str.substr(close_bracket + 1);
-    }
-
-public:
-    /*
-     * Constructor
-     */
-
-    /// Create an empty string.
-    Str() = default;
-
-    /// Create a string from null-terminated characters.
-    Str(const char* chars)
-        : str_(chars)
-    {
-    }
-
-    /// Create a string from std::string.
-    Str(const std::string& string)
-        : str_(string)
-    {
-    }
-
-    /// Copy constructor.
-    Str(const Str& that) = default;
-
-    /// Move constructor.
-    Str(Str&& that)
-        : str_(std::move(const_cast<std::string&>(that.str_)))
-    {
-    }
-
-    /*
-     * Comparison
-     */
-
-    /// Compare the string with another string.
-    auto operator<=>(const Str& that) const = default;
-
-    /*
-     * Assignment
-     */
-
-    /// Copy assignment operator.
-    Str& operator=(const Str& that)
-    {
-        const_cast<std::string&>(str_) = that.str_;
-        return *this;
-    }
-
-    /// Move assignment operator.
-    Str& operator=(Str&& that)
-    {
-        const_cast<std::string&>(str_) = std::move(const_cast<std::string&>(that.str_));
-        return *this;
-    }
-
-    /*
-     * Iterator
-     */
-
-    /// Return an iterator to the first char of the string.
-    auto begin() const
-    {
-        return str_.cbegin();
-    }
-
-    /// Return an iterator to the char following the last char of the string.
-    auto end() const
-    {
-        return str_.cend();
-    }
-
-    /// Return a reverse iterator to the first char of the reversed string.
-    auto rbegin() const
-    {
-        return str_.crbegin();
-    }
-
-    /// Return a reverse iterator to the char following the last char of the reversed string.
-    auto rend() const
-    {
-        return str_.crend();
-    }
-
-    /*
-     * Access
-     */
-
-    /// Return the const reference to element at the specified position in the string.
-    /// Index can be negative, like Python's string: string[-1] gets the last element.
-    const char& operator[](int index) const
-    {
-        detail::check_bounds(index, -size(), size());
-
-        return str_[index >= 0 ? index : index + size()];
-    }
-
-    /*
-     * Examination
-     */
-
-    /// Return the number of elements in the string.
-    int size() const
-    {
-        return str_.size(); // no '\0'
-    }
-
-    /// Return true if the string contains no elements.
-    bool is_empty() const
-    {
-        return str_.empty();
-    }
-
-    /// Return const pointer to contents. This is a pointer to internal data.
-    /// It is undefined to modify the contents through the returned pointer.
-    const char* data() const
-    {
-        return str_.data();
-    }
-
-    /// Return the index of the first occurrence of the specified pattern in the specified range [`start`, `stop`).
-    /// Or -1 if the string does not contain the pattern (in the specified range).
-    int find(const Str& pattern, int start = 0, int stop = INT_MAX) const
-    {
-        if (start > size())
-        {
-            return -1;
-        }
-
-        stop = stop > size() ? size() : stop;
-        std::string_view view(str_.data() + start, stop - start);
-        auto pos = view.find(pattern.str_);
-
-        return pos == std::string::npos ? -1 : start + int(pos);
-    }
-
-    /// Return `true` if the string contains the specified `pattern` in the specified range [`start`, `stop`).
-    bool contains(const Str& pattern, int start = 0, int stop = INT_MAX) const
-    {
-        return find(pattern, start, stop) != -1;
-    }
-
-    /// Count the total number of occurrences of the specified `pattern` in the string.
-    int count(const Str& pattern) const
-    {
-        if (pattern.is_empty())
-        {
-            return size() + 1;
-        }
-
-        int cnt = 0;
-        for (int start = 0; (start = find(pattern, start)) != -1; start += pattern.size())
-        {
-            ++cnt;
-        }
-
-        return cnt;
-    }
-
-    /// Convert the string to a double-precision floating-point decimal number.
-    ///
-    /// If the string is too big to be representable will return `HUGE_VAL`.
-    /// If the string represents NaN will return `NAN`.
-    /// If the string represents Infinity will return `(+-)INFINITY`.
-    ///
-    /// ### Example
-    /// ```
-    /// Str("233.33").to_decimal(); // 233.33
-    /// Str("123.456e-3").to_decimal(); // 0.123456
-    /// Str("1e+600").to_decimal(); // HUGE_VAL
-    /// Str("nan").to_decimal(); // NAN
-    /// Str("inf").to_decimal(); // INFINITY
-    /// ```
-    double to_decimal() const
-    {
-        // check infinity or nan
-        static const char* pos_infs[12] = {"inf", "INF", "Inf", "+inf", "+INF", "+Inf", "infinity", "INFINITY", "Infinity", "+infinity", "+INFINITY", "+Infinity"};
-        static const char* neg_infs[6] = {"-inf", "-INF", "-Inf", "-infinity", "-INFINITY", "-Infinity"};
-        static const char* nans[9] = {"nan", "NaN", "NAN", "+nan", "+NaN", "+NAN", "-nan", "-NaN", "-NAN"};
-
-        for (int i = 0; i < 12; ++i)
-        {
-            if (str_ == pos_infs[i])
-            {
-                return INFINITY;
-            }
-        }
-        for (int i = 0; i < 6; ++i)
-        {
-            if (str_ == neg_infs[i])
-            {
-                return -INFINITY;
-            }
-        }
-        for (int i = 0; i < 9; ++i)
-        {
-            if (str_ == nans[i])
-            {
-                return NAN;
-            }
-        }
-
-        // not infinity or nan
-
-        double sign = 1; // default '+'
-        double decimal_part = 0;
-        int decimal_cnt = 0;
-        double exp_sign = 1; // default '+'
-        int exp_part = 0;
-
-        // FSM
-        state st = S_START;
-        for (int i = 0; i < size(); ++i)
-        {
-            event ev = get_event(str_[i], 10);
-            switch (int(st) | int(ev))
-            {
-                case int(S_START) | int(E_BLANK):
-                    st = S_START;
-                    break;
-
-                case int(S_START) | int(E_SIGN):
-                    sign = (str_[i] == '+') ? 1 : -1;
-                    st = S_SIGN;
-                    break;
-
-                case int(S_START) | int(E_POINT):
-                case int(S_SIGN) | int(E_POINT):
-                    st = S_POINT;
-                    break;
-
-                case int(S_START) | int(E_DIGIT):
-                case int(S_SIGN) | int(E_DIGIT):
-                case int(S_INT) | int(E_DIGIT):
-                    decimal_part = decimal_part * 10 + char_to_integer(str_[i], 10);
-                    st = S_INT;
-                    break;
-
-                case int(S_INT) | int(E_POINT):
-                    st = S_DEC;
-                    break;
-
-                case int(S_POINT) | int(E_DIGIT):
-                case int(S_DEC) | int(E_DIGIT):
-                    decimal_part = decimal_part * 10 + char_to_integer(str_[i], 10);
-                    decimal_cnt++;
-                    st = S_DEC;
-                    break;
-
-                case int(S_INT) | int(E_EXP):
-                case int(S_DEC) | int(E_EXP):
-                    st = S_EXP;
-                    break;
-
-                case int(S_EXP) | int(E_SIGN):
-                    exp_sign = (str_[i] == '+') ? 1 : -1;
-                    st = S_EXP_SIGN;
-                    break;
-
-                case int(S_EXP) | int(E_DIGIT):
-                case int(S_EXP_SIGN) | int(E_DIGIT):
-                case int(S_EXP_NUM) | int(E_DIGIT):
-                    exp_part = exp_part * 10 + char_to_integer(str_[i], 10);
-                    st = S_EXP_NUM;
-                    break;
-
-                case int(S_INT) | int(E_BLANK):
-                case int(S_DEC) | int(E_BLANK):
-                case int(S_EXP_NUM) | int(E_BLANK):
-                case int(S_END) | int(E_BLANK):
-                    st = S_END;
-                    break;
-
-                default:
-                    st = S_OTHER;
-                    i = size(); // exit loop
-                    break;
-            }
-        }
-        if (st != S_INT && st != S_DEC && st != S_EXP_NUM && st != S_END)
-        {
-            throw std::runtime_error("Error: Invalid literal for to_decimal().");
-        }
-
-        return sign * ((decimal_part / std::pow(10, decimal_cnt)) * std::pow(10, exp_sign * exp_part));
-    }
-
-    /// Convert the string to an `Int` based on 2-36 `base`.
-    ///
-    /// Numeric character in 36 base: 0, 1, ..., 9, A(10), ..., F(15), G(16), ..., Y(34), Z(35).
-    ///
-    /// ### Example
-    /// ```
-    /// Str("233").to_integer(); // 233
-    /// Str("cafebabe").to_integer(16); // 3405691582
-    /// Str("z").to_integer(36); // 35
-    /// Str("ffffffffffffffff").to_integer(16); // 18446744073709551615
-    /// ```
-    Int to_integer(int base = 10) const
-    {
-        // check base
-        if (base < 2 || base > 36)
-        {
-            throw std::runtime_error("Error: Invalid base for to_integer().");
-        }
-
-        bool non_negative = true; // default '+'
-        Int integer;
-
-        // FSM
-        state st = S_START;
-        for (int i = 0; i < size(); ++i)
-        {
-            event ev = get_event(str_[i], base);
-            switch (int(st) | int(ev))
-            {
-                case int(S_START) | int(E_BLANK):
-                    st = S_START;
-                    break;
-
-                case int(S_START) | int(E_SIGN):
-                    non_negative = (str_[i] == '+') ? true : false;
-                    st = S_SIGN;
-                    break;
-
-                case int(S_START) | int(E_DIGIT):
-                case int(S_SIGN) | int(E_DIGIT):
-                case int(S_INT) | int(E_DIGIT):
-                    integer = integer * base + char_to_integer(str_[i], base);
-                    st = S_INT;
-                    break;
-
-                case int(S_INT) | int(E_BLANK):
-                case int(S_END) | int(E_BLANK):
-                    st = S_END;
-                    break;
-
-                default:
-                    st = S_OTHER;
-                    i = size(); // exit loop
-                    break;
-            }
-        }
-        if (st != S_INT && st != S_END)
-        {
-            throw std::runtime_error("Error: Invalid literal for to_integer().");
-        }
-
-        return non_negative ? integer : -integer;
-    }
-
-    /// Return `true` if the string begins with the specified string, otherwise return `false`.
-    bool starts_with(const Str& str) const
-    {
-        return str_.starts_with(str.str_);
-    }
-
-    /// Return `true` if the string ends with the specified string, otherwise return `false`.
-    bool ends_with(const Str& str) const
-    {
-        return str_.ends_with(str.str_);
-    }
-
-    /*
-     * Production
-     */
-
-    /// Copy and rotate the string to right `n` characters.
-    Str operator>>(int n) const
-    {
-        if (size() <= 1 || n == 0)
-        {
-            return *this;
-        }
-
-        if (n < 0)
-        {
-            return *this << -n;
-        }
-
-        return *this << size() - n;
-    }
-
-    /// Copy and rotate the string to left `n` characters.
-    Str operator<<(int n) const
-    {
-        if (size() <= 1 || n == 0)
-        {
-            return *this;
-        }
-
-        n %= size();
-
-        if (n < 0)
-        {
-            n += size();
-        }
-
-        std::string buffer(size(), 0);
-        std::rotate_copy(begin(), begin() + n, end(), buffer.begin());
-
-        return buffer;
-    }
-
-    /// Rerurn the reversed string.
-    Str reverse() const
-    {
-        std::string buffer(size(), 0);
-        std::reverse_copy(begin(), end(), buffer.begin());
-
-        return buffer;
-    }
-
-    /// Return a copy of the string with all the characters converted to lowercase.
-    Str lower() const
-    {
-        std::string buffer = str_;
-        for (char& c : buffer)
-        {
-            if (c >= 'A' && c <= 'Z')
-            {
-                c |= 0b0010'0000;
-            }
-        }
-
-        return buffer;
-    }
-
-    /// Return a copy of the string with all the characters converted to uppercase.
-    Str upper() const
-    {
-        std::string buffer = str_;
-        for (char& c : buffer)
-        {
-            if (c >= 'a' && c <= 'z')
-            {
-                c &= 0b1101'1111;
-            }
-        }
-
-        return buffer;
-    }
-
-    /// Return a copy of the string and erase the contents of the string in the range [`start`, `stop`).
-    Str erase(int start, int stop) const
-    {
-        detail::check_bounds(start, 0, size() + 1);
-        detail::check_bounds(stop, 0, size() + 1);
-
-        std::string buffer = str_;
-        buffer.erase(buffer.begin() + start, buffer.begin() + stop);
-
-        return buffer;
-    }
-
-    /// Replace the string.
-    ///
-    /// ### Example
-    /// ```
-    /// Str("hahaha").replace("a", "ooow~").replace("ooow", "o"); // "ho~ho~ho~"
-    /// Str("abcdefg").replace("", "-"); // "-a-b-c-d-e-f-g-"
-    /// ```
-    Str replace(const Str& old_str, const Str& new_str) const
-    {
-        if (old_str.is_empty())
-        {
-            std::ostringstream ss;
-            std::copy(str_.begin(), str_.end(), std::ostream_iterator<char>(ss, new_str.data()));
-            return new_str.str_ + ss.str();
-        }
-
-        std::string buffer;
-
-        int this_start = 0;
-        for (int patt_start = 0; (patt_start = find(old_str, this_start)) != -1; this_start = patt_start + old_str.size())
-        {
-            buffer += str_.substr(this_start, patt_start - this_start) + new_str.str_;
-        }
-
-        return buffer += str_.substr(this_start);
-    }
-
-    /// Remove leading and trailing characters (default is blank character) of the string.
-    Str strip(const signed char& ch = -1) const
-    {
-        std::string buffer = str_;
-
-        int i = 0;
-        while (i < int(buffer.size()) && (ch == -1 ? buffer[i] <= 0x20 : buffer[i] == ch))
-        {
-            ++i;
-        }
-        buffer.erase(buffer.begin(), buffer.begin() + i);
-
-        i = buffer.size() - 1;
-        while (i >= 0 && (ch == -1 ? buffer[i] <= 0x20 : buffer[i] == ch))
-        {
-            --i;
-        }
-        buffer.erase(buffer.begin() + i + 1, buffer.end());
-
-        return buffer;
-    }
-
-    /// Return slice of the string from `start` to `stop` with certain `step`.
-    /// Index and step length can be negative.
-    Str slice(int start, int stop, int step = 1) const
-    {
-        if (step == 0)
-        {
-            throw std::runtime_error("Error: Require step != 0 for slice(start, stop, step).");
-        }
-
-        detail::check_bounds(start, -size(), size());
-        detail::check_bounds(stop, -size() - 1, size() + 1);
-
-        // convert
-        start = start < 0 ? start + size() : start;
-        stop = stop < 0 ? stop + size() : stop;
-
-        // copy
-        std::string buffer;
-        for (int i = start; (step > 0) ? (i < stop) : (i > stop); i += step)
-        {
-            buffer += str_[i];
-        }
-
-        return buffer;
-    }
-
-    /// Generate a new string and append the specified `element` to the end of the string.
-    Str operator+(const char& element) const
-    {
-        return str_ + element;
-    }
-
-    /// Generate a new string and append the specified `string` to the end of the string.
-    Str operator+(const Str& string) const
-    {
-        return str_ + string.str_;
-    }
-
-    /// Generate a new string and add the string to itself a certain number of `times`.
-    Str operator*(int times) const
-    {
-        if (times < 0)
-        {
-            throw std::runtime_error("Error: Require times >= 0 for repeat.");
-        }
-
-        std::string buffer(size() * times, 0);
-        for (int part = 0; part < times; part++)
-        {
-            std::copy(begin(), end(), buffer.begin() + size() * part);
-        }
-
-        return buffer;
-    }
-
-    /// Split the string with separator (default = " ").
-    /// If `keep_empty` is set (default = false), empty strings will be retained.
-    ///
-    /// ### Example
-    /// ```
-    /// Str("one, two, three").split(", "); // ["one", "two", "three"]
-    /// Str("   1   2   3   ").split(); // ["1", "2", "3"]
-    /// Str("aaa").split("a"); // []
-    /// Str("aaa").split("a", true); // ["", "", "", ""]
-    /// ```
-    List<Str> split(const Str& sep = " ", bool keep_empty = false) const
-    {
-        if (sep.is_empty())
-        {
-            throw std::runtime_error("Error: Empty separator.");
-        }
-
-        List<Str> str_list;
-        int this_start = 0;
-        for (int patt_start = 0; (patt_start = find(sep, this_start)) != -1; this_start = patt_start + sep.size())
-        {
-            if (!keep_empty && patt_start == this_start) // skip empty str
-            {
-                continue;
-            }
-            str_list += str_.substr(this_start, patt_start - this_start);
-        }
-        if (keep_empty || this_start != size())
-        {
-            str_list += str_.substr(this_start);
-        }
-
-        return str_list;
-    }
-
-    /// Return a string which is the concatenation of the strings in `str_list`.
-    ///
-    /// ### Example
-    /// ```
-    /// Str(".").join({"192", "168", "0", "1"}) // "192.168.0.1"
-    /// ```
-    Str join(const List<Str>& str_list) const
-    {
-        if (str_list.is_empty())
-        {
-            return Str();
-        }
-
-        std::string buffer = str_list[0].str_;
-        for (int i = 1; i < str_list.size(); ++i)
-        {
-            buffer += str_ + str_list[i].str_;
-        }
-        return buffer;
-    }
-
-    /// Format `args` according to the format string, and return the result as a string.
-    template <typename... Args>
-    Str format(const Args&... args) const
-    {
-        std::ostringstream oss;
-        std::string_view str(str_);
-        (format_helper(oss, str, args), ...);
-        oss << str;
-        return oss.str();
-    }
-
-    /*
-     * Print / Input
-     */
-
-    /// Output the string to the specified output stream.
-    friend std::ostream& operator<<(std::ostream& os, const Str& string)
-    {
-        os << "\"";
-        std::for_each(string.begin(), string.end(), [&](const char& c)
-                      { os << c; });
-        os << "\"";
-
-        return os;
-    }
-
-    /// Get a line of string from the specified input stream.
-    friend std::istream& operator>>(std::istream& is, Str& string)
-    {
-        return std::getline(is, const_cast<std::string&>(string.str_));
-    }
-
-    friend struct std::hash<pyincpp::Str>;
-};
-
-} // namespace pyincpp
-
-template <>
-struct std::hash<pyincpp::Str> // explicit specialization
-{
-    std::size_t operator()(const pyincpp::Str& string) const
-    {
-        return std::hash<std::string>{}(string.str_);
-    }
-};
-
-#endif // STR_HPP
+//! @file str.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Str class.
+//! @date 2023.01.08
+
+#ifndef STR_HPP
+#define STR_HPP
+
+#include "detail.hpp"
+
+#include "int.hpp"
+#include "list.hpp"
+#include "str_view.hpp"
+
+namespace pyincpp
+{
+
+/// Str is immutable sequence of characters.
+/// The characters live in a shared reference-counted buffer, so copies and substrings (`slice` with step 1, `strip`, `split`)
+/// refer to the same buffer in O(1) time instead of copying. Note that a substring keeps the whole buffer alive.
+/// The reference count is atomic, define `PYINCPP_STR_SINGLE_THREAD` before including to use a plain count
+/// if strings are never shared between threads.
+class Str
+{
+private:
+#ifdef PYINCPP_STR_SINGLE_THREAD
+    using Count = int;
+#else
+    using Count = std::atomic<int>;
+#endif
+
+    // Shared characters with the number of strings referring to them.
+    struct Buffer
+    {
+        Count count;
+        const std::string chars;
+    };
+
+    // Buffer, null for an empty string.
+    Buffer* buffer_ = nullptr;
+
+    // Pointer to the first character in the buffer, not null-terminated for a substring.
+    const char* data_ = "";
+
+    // Number of characters.
+    int size_ = 0;
+
+    // Cached hash value, 0 if not computed yet.
+    mutable std::size_t hash_ = 0;
+
+    // Create a substring of `that` from `start` with `size` characters sharing the buffer.
+    Str(const Str& that, int start, int size)
+    {
+        if (size > 0)
+        {
+            buffer_ = that.buffer_;
+            data_ = that.data_ + start;
+            size_ = size;
+            ++buffer_->count;
+        }
+    }
+
+    // Release the buffer, free it if this is the last string referring to it.
+    void release()
+    {
+        if (buffer_ && --buffer_->count == 0)
+        {
+            delete buffer_;
+        }
+    }
+
+    // Copy the characters of `str` to `out`, return the position after them.
+    static char* copy(const StrView& str, char* out)
+    {
+        std::memcpy(out, str.data(), str.size());
+        return out + str.size();
+    }
+
+    // Return the characters as std::string_view.
+    std::string_view view() const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    // Format helper, see https://codereview.stackexchange.com/questions/269425/implementing-stdformat
+    template <typename T>
+    static void format_helper(std::ostringstream& oss, std::string_view& str, const T& value)
+    {
+        std::size_t open_bracket = str.find('{');
+        std::size_t close_bracket = str.find('}', open_bracket + 1);
+        if (open_bracket == std::string::npos || close_bracket == std::string::npos)
+        {
+            return;
+        }
+        oss << str.substr(0, open_bracket) << value;
+        str = str.substr(close_bracket + 1);
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty string.
+    Str() = default;
+
+    /// Create a string from null-terminated characters.
+    Str(const char* chars)
+        : Str(std::string(chars))
+    {
+    }
+
+    /// Create a string from std::string.
+    Str(const std::string& string)
+        : Str(std::string(string))
+    {
+    }
+
+    /// Create a string by moving from std::string.
+    Str(std::string&& string)
+    {
+        if (!string.empty())
+        {
+            buffer_ = new Buffer{1, std::move(string)};
+            data_ = buffer_->chars.data();
+            size_ = buffer_->chars.size();
+        }
+    }
+
+    /// Create a string with a copy of the characters of `view`.
+    explicit Str(const StrView& view)
+        : Str(std::string(view.data(), view.size()))
+    {
+    }
+
+    /// Copy constructor, share the buffer.
+    Str(const Str& that)
+        : buffer_(that.buffer_)
+        , data_(that.data_)
+        , size_(that.size_)
+        , hash_(that.hash_)
+    {
+        if (buffer_)
+        {
+            ++buffer_->count;
+        }
+    }
+
+    /// Move constructor.
+    Str(Str&& that)
+        : buffer_(std::exchange(that.buffer_, nullptr))
+        , data_(std::exchange(that.data_, ""))
+        , size_(std::exchange(that.size_, 0))
+        , hash_(std::exchange(that.hash_, 0))
+    {
+    }
+
+    /// Destructor.
+    ~Str()
+    {
+        release();
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this string is equal to another string.
+    bool operator==(const Str& that) const
+    {
+        return view() == that.view();
+    }
+
+    /// Compare the string with another string.
+    auto operator<=>(const Str& that) const
+    {
+        return view() <=> that.view();
+    }
+
+    /*
+     * Assignment
+     */
+
+    /// Copy assignment operator.
+    Str& operator=(const Str& that)
+    {
+        return *this = Str(that);
+    }
+
+    /// Move assignment operator.
+    Str& operator=(Str&& that)
+    {
+        if (this != &that)
+        {
+            release();
+            buffer_ = std::exchange(that.buffer_, nullptr);
+            data_ = std::exchange(that.data_, "");
+            size_ = std::exchange(that.size_, 0);
+            hash_ = std::exchange(that.hash_, 0);
+        }
+        return *this;
+    }
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first char of the string.
+    auto begin() const
+    {
+        return data_;
+    }
+
+    /// Return an iterator to the char following the last char of the string.
+    auto end() const
+    {
+        return data_ + size_;
+    }
+
+    /// Return a reverse iterator to the first char of the reversed string.
+    auto rbegin() const
+    {
+        return std::make_reverse_iterator(end());
+    }
+
+    /// Return a reverse iterator to the char following the last char of the reversed string.
+    auto rend() const
+    {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the const reference to element at the specified position in the string.
+    /// Index can be negative, like Python's string: string[-1] gets the last element.
+    const char& operator[](int index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        return data_[index >= 0 ? index : index + size()];
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of elements in the string.
+    int size() const
+    {
+        return size_; // no '\0'
+    }
+
+    /// Return true if the string contains no elements.
+    bool is_empty() const
+    {
+        return size_ == 0;
+    }
+
+    /// Return the view of the whole string, valid while the buffer is alive.
+    operator StrView() const
+    {
+        return StrView(data_, size_);
+    }
+
+    /// Return const pointer to contents. This is a pointer to internal data, not null-terminated for a substring.
+    /// It is undefined to modify the contents through the returned pointer.
+    const char* data() const
+    {
+        return data_;
+    }
+
+    /// Return the index of the first occurrence of the specified pattern in the specified range [`start`, `stop`).
+    /// Or -1 if the string does not contain the pattern (in the specified range).
+    int find(const StrView& pattern, int start = 0, int stop = INT_MAX) const
+    {
+        return StrView(*this).find(pattern, start, stop);
+    }
+
+    /// Return `true` if the string contains the specified `pattern` in the specified range [`start`, `stop`).
+    bool contains(const StrView& pattern, int start = 0, int stop = INT_MAX) const
+    {
+        return find(pattern, start, stop) != -1;
+    }
+
+    /// Count the total number of occurrences of the specified `pattern` in the string.
+    int count(const StrView& pattern) const
+    {
+        return StrView(*this).count(pattern);
+    }
+
+    /// Convert the string to a double-precision floating-point decimal number.
+    ///
+    /// If the string is too big to be representable will return `HUGE_VAL`.
+    /// If the string represents NaN will return `NAN`.
+    /// If the string represents Infinity will return `(+-)INFINITY`.
+    ///
+    /// ### Example
+    /// ```
+    /// Str("233.33").to_decimal(); // 233.33
+    /// Str("123.456e-3").to_decimal(); // 0.123456
+    /// Str("1e+600").to_decimal(); // HUGE_VAL
+    /// Str("nan").to_decimal(); // NAN
+    /// Str("inf").to_decimal(); // INFINITY
+    /// ```
+    double to_decimal() const
+    {
+        return StrView(*this).to_decimal();
+    }
+
+    /// Convert the string to an `Int` based on 2-36 `base`.
+    ///
+    /// Numeric character in 36 base: 0, 1, ..., 9, A(10), ..., F(15), G(16), ..., Y(34), Z(35).
+    ///
+    /// ### Example
+    /// ```
+    /// Str("233").to_integer(); // 233
+    /// Str("cafebabe").to_integer(16); // 3405691582
+    /// Str("z").to_integer(36); // 35
+    /// Str("ffffffffffffffff").to_integer(16); // 18446744073709551615
+    /// ```
+    Int to_integer(int base = 10) const
+    {
+        return StrView(*this).to_integer(base);
+    }
+
+    /// Return `true` if the string begins with the specified string, otherwise return `false`.
+    bool starts_with(const StrView& str) const
+    {
+        return StrView(*this).starts_with(str);
+    }
+
+    /// Return `true` if the string ends with the specified string, otherwise return `false`.
+    bool ends_with(const StrView& str) const
+    {
+        return StrView(*this).ends_with(str);
+    }
+
+    /*
+     * Production
+     */
+
+    /// Copy and rotate the string to right `n` characters.
+    Str operator>>(int n) const
+    {
+        if (size() <= 1 || n == 0)
+        {
+            return *this;
+        }
+
+        if (n < 0)
+        {
+            return *this << -n;
+        }
+
+        return *this << size() - n;
+    }
+
+    /// Copy and rotate the string to left `n` characters.
+    Str operator<<(int n) const
+    {
+        if (size() <= 1 || n == 0)
+        {
+            return *this;
+        }
+
+        n %= size();
+
+        if (n < 0)
+        {
+            n += size();
+        }
+
+        std::string buffer(size(), 0);
+        std::rotate_copy(begin(), begin() + n, end(), buffer.begin());
+
+        return buffer;
+    }
+
+    /// Rerurn the reversed string.
+    Str reverse() const
+    {
+        std::string buffer(size(), 0);
+        std::reverse_copy(begin(), end(), buffer.begin());
+
+        return buffer;
+    }
+
+    /// Return a copy of the string with all the characters converted to lowercase.
+    Str lower() const
+    {
+        std::string buffer(view());
+        for (char& c : buffer)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c |= 0b0010'0000;
+            }
+        }
+
+        return buffer;
+    }
+
+    /// Return a copy of the string with all the characters converted to uppercase.
+    Str upper() const
+    {
+        std::string buffer(view());
+        for (char& c : buffer)
+        {
+            if (c >= 'a' && c <= 'z')
+            {
+                c &= 0b1101'1111;
+            }
+        }
+
+        return buffer;
+    }
+
+    /// Return a copy of the string and erase the contents of the string in the range [`start`, `stop`).
+    Str erase(int start, int stop) const
+    {
+        detail::check_bounds(start, 0, size() + 1);
+        detail::check_bounds(stop, 0, size() + 1);
+
+        std::string buffer(view());
+        buffer.erase(buffer.begin() + start, buffer.begin() + stop);
+
+        return buffer;
+    }
+
+    /// Replace the string.
+    ///
+    /// ### Example
+    /// ```
+    /// Str("hahaha").replace("a", "ooow~").replace("ooow", "o"); // "ho~ho~ho~"
+    /// Str("abcdefg").replace("", "-"); // "-a-b-c-d-e-f-g-"
+    /// ```
+    Str replace(const StrView& old_str, const StrView& new_str) const
+    {
+        // two passes: count the occurrences for the exact size, then copy the pieces into one allocation
+
+        if (old_str.is_empty())
+        {
+            std::string buffer(size() + (size() + 1ull) * new_str.size(), '\0');
+            char* out = buffer.data();
+            for (int i = 0; i < size(); ++i)
+            {
+                out = copy(new_str, out);
+                *out++ = data_[i];
+            }
+            copy(new_str, out);
+            return buffer;
+        }
+
+        const int occurrences = count(old_str);
+        if (occurrences == 0)
+        {
+            return *this; // share the buffer
+        }
+
+        std::string buffer(size() + (long long)occurrences * (new_str.size() - old_str.size()), '\0');
+        char* out = buffer.data();
+        int this_start = 0;
+        for (int patt_start = 0; (patt_start = find(old_str, this_start)) != -1; this_start = patt_start + old_str.size())
+        {
+            out = copy(StrView(data_ + this_start, patt_start - this_start), out);
+            out = copy(new_str, out);
+        }
+        copy(StrView(data_ + this_start, size() - this_start), out);
+
+        return buffer;
+    }
+
+    /// Remove leading and trailing characters (default is blank character) of the string.
+    /// The result shares the buffer of this.
+    Str strip(const signed char& ch = -1) const
+    {
+        auto stripped = [&](char c)
+        {
+            return ch == -1 ? c <= 0x20 : c == ch;
+        };
+
+        int start = 0;
+        while (start < size() && stripped(data_[start]))
+        {
+            ++start;
+        }
+
+        int stop = size();
+        while (stop > start && stripped(data_[stop - 1]))
+        {
+            --stop;
+        }
+
+        return Str(*this, start, stop - start);
+    }
+
+    /// Like strip(), but return a view into this string without touching the reference count.
+    StrView strip_view(const signed char& ch = -1) const
+    {
+        return StrView(*this).strip(ch);
+    }
+
+    /// Return slice of the string from `start` to `stop` with certain `step`.
+    /// Index and step length can be negative. With step 1, the result shares the buffer of this.
+    Str slice(int start, int stop, int step = 1) const
+    {
+        if (step == 0)
+        {
+            throw std::runtime_error("Error: Require step != 0 for slice(start, stop, step).");
+        }
+
+        detail::check_bounds(start, -size(), size());
+        detail::check_bounds(stop, -size() - 1, size() + 1);
+
+        // convert
+        start = start < 0 ? start + size() : start;
+        stop = stop < 0 ? stop + size() : stop;
+
+        if (step == 1)
+        {
+            return Str(*this, start, std::max(stop - start, 0));
+        }
+
+        // copy
+        std::string buffer;
+        for (int i = start; (step > 0) ? (i < stop) : (i > stop); i += step)
+        {
+            buffer += data_[i];
+        }
+
+        return buffer;
+    }
+
+    /// Like slice() with step 1, but return a view into this string without touching the reference count.
+    StrView slice_view(int start, int stop) const
+    {
+        return StrView(*this).slice(start, stop);
+    }
+
+    /// Generate a new string and append the specified `element` to the end of the string.
+    Str operator+(const char& element) const
+    {
+        std::string buffer(view());
+        buffer += element;
+        return buffer;
+    }
+
+    /// Generate a new string and append the specified `string` to the end of the string.
+    Str operator+(const Str& string) const
+    {
+        std::string buffer;
+        buffer.reserve(size() + string.size());
+        buffer += view();
+        buffer += string.view();
+        return buffer;
+    }
+
+    /// Generate a new string and add the string to itself a certain number of `times`.
+    Str operator*(int times) const
+    {
+        if (times < 0)
+        {
+            throw std::runtime_error("Error: Require times >= 0 for repeat.");
+        }
+
+        std::string buffer(size() * times, 0);
+        for (int part = 0; part < times; part++)
+        {
+            std::copy(begin(), end(), buffer.begin() + size() * part);
+        }
+
+        return buffer;
+    }
+
+    /// Split the string with separator (default = " ").
+    /// If `keep_empty` is set (default = false), empty strings will be retained.
+    /// The parts share the buffer of this.
+    ///
+    /// ### Example
+    /// ```
+    /// Str("one, two, three").split(", "); // ["one", "two", "three"]
+    /// Str("   1   2   3   ").split(); // ["1", "2", "3"]
+    /// Str("aaa").split("a"); // []
+    /// Str("aaa").split("a", true); // ["", "", "", ""]
+    /// ```
+    List<Str> split(const Str& sep = " ", bool keep_empty = false) const
+    {
+        if (sep.is_empty())
+        {
+            throw std::runtime_error("Error: Empty separator.");
+        }
+
+        List<Str> str_list;
+        int this_start = 0;
+        for (int patt_start = 0; (patt_start = find(sep, this_start)) != -1; this_start = patt_start + sep.size())
+        {
+            if (!keep_empty && patt_start == this_start) // skip empty str
+            {
+                continue;
+            }
+            str_list += Str(*this, this_start, patt_start - this_start);
+        }
+        if (keep_empty || this_start != size())
+        {
+            str_list += Str(*this, this_start, size() - this_start);
+        }
+
+        return str_list;
+    }
+
+    /// Like split(), but return views into this string without touching the reference count.
+    ///
+    /// ### Example
+    /// ```
+    /// Str line = "GET /index.html 200";
+    /// for (const auto& token : line.split_view()) { ... } // no allocation per token
+    /// ```
+    List<StrView> split_view(const StrView& sep = " ", bool keep_empty = false) const
+    {
+        return StrView(*this).split(sep, keep_empty);
+    }
+
+    /// Lazily split the string into views, see StrView::split_iter(). The string must outlive the iteration.
+    ///
+    /// ### Example
+    /// ```
+    /// Str line = "2024-01-01 12:00:00 INFO a very long message";
+    /// for (const auto& field : line.split_iter(" ", false, 2)) { ... } // "2024-01-01", "12:00:00", "INFO a very long message"
+    /// ```
+    StrView::SplitRange split_iter(const StrView& sep = " ", bool keep_empty = false, int maxsplit = -1) const
+    {
+        return StrView(*this).split_iter(sep, keep_empty, maxsplit);
+    }
+
+    /// Return a string which is the concatenation of the strings in `str_list`.
+    ///
+    /// ### Example
+    /// ```
+    /// Str(".").join({"192", "168", "0", "1"}) // "192.168.0.1"
+    /// ```
+    Str join(const List<Str>& str_list) const
+    {
+        return join<List<Str>>(str_list);
+    }
+
+    /// Return a string which is the concatenation of the strings in the `range` of Str, StrView or anything convertible to StrView.
+    /// The sizes are summed first, so the result is allocated once and the pieces are copied into it.
+    ///
+    /// ### Example
+    /// ```
+    /// Str(",").join(Str("a b c").split_view()) // "a,b,c"
+    /// ```
+    template <std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<const R>, StrView>
+    Str join(const R& range) const
+    {
+        std::size_t total = 0;
+        std::size_t parts = 0;
+        for (const auto& part : range)
+        {
+            total += StrView(part).size();
+            ++parts;
+        }
+        if (parts == 0)
+        {
+            return Str();
+        }
+
+        std::string buffer(total + size() * (parts - 1), '\0');
+        char* out = buffer.data();
+        bool first = true;
+        for (const auto& part : range)
+        {
+            if (!first)
+            {
+                out = copy(*this, out);
+            }
+            out = copy(part, out);
+            first = false;
+        }
+
+        return buffer;
+    }
+
+    /// Format `args` according to the format string, and return the result as a string.
+    template <typename... Args>
+    Str format(const Args&... args) const
+    {
+        std::ostringstream oss;
+        std::string_view str = view();
+        (format_helper(oss, str, args), ...);
+        oss << str;
+        return oss.str();
+    }
+
+    /*
+     * Print / Input
+     */
+
+    /// Output the string to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const Str& string)
+    {
+        os << "\"";
+        std::for_each(string.begin(), string.end(), [&](const char& c)
+                      { os << c; });
+        os << "\"";
+
+        return os;
+    }
+
+    /// Get a line of string from the specified input stream.
+    friend std::istream& operator>>(std::istream& is, Str& string)
+    {
+        std::string line;
+        std::getline(is, line);
+        string = Str(std::move(line));
+        return is;
+    }
+
+    friend struct std::hash<pyincpp::Str>;
+};
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::Str> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::Str& string) const
+    {
+        // computed once, an immutable string always has the same hash
+        if (string.hash_ == 0)
+        {
+            string.hash_ = pyincpp::detail::hash_bytes(string.data(), string.size());
+            string.hash_ += string.hash_ == 0; // 0 means not computed
+        }
+        return string.hash_;
+    }
+};
+
+#endif // STR_HPP
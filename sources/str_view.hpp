@@ -0,0 +1,738 @@
+//! @file str_view.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief StrView class.
+//! @date 2026.10.17
+
+#ifndef STR_VIEW_HPP
+#define STR_VIEW_HPP
+
+#include "detail.hpp"
+
+#include "int.hpp"
+#include "list.hpp"
+
+namespace pyincpp
+{
+
+/// StrView is a non-owning view of a sequence of characters with the read-only API of Str.
+/// Slicing, stripping and splitting a view return views into the same characters without allocation.
+/// The characters must outlive the view.
+class StrView
+{
+private:
+    // Pointer to the first character, not null-terminated.
+    const char* data_ = "";
+
+    // Number of characters.
+    int size_ = 0;
+
+    // Used for FSM.
+    enum state
+    {
+        S_START = 1 << 0,    // start with blank character
+        S_SIGN = 1 << 1,     // positive or negative sign
+        S_INT = 1 << 2,      // integer part
+        S_POINT = 1 << 3,    // decimal point that doesn't have left digit
+        S_DEC = 1 << 4,      // decimal part
+        S_EXP = 1 << 5,      // scientific notation identifier
+        S_EXP_SIGN = 1 << 6, // positive or negative sign of exponent part
+        S_EXP_NUM = 1 << 7,  // exponent part number
+        S_END = 1 << 8,      // end with blank character
+        S_OTHER = 1 << 9,    // other
+    };
+
+    // Used for FSM.
+    enum event
+    {
+        E_BLANK = 1 << 10, // blank character: ' ', '\n', '\t', '\r'
+        E_SIGN = 1 << 11,  // positive or negative sign: '+', '-'
+        E_DIGIT = 1 << 12, // 36-based digit: '[0-9a-zA-Z]'
+        E_POINT = 1 << 13, // decimal point: '.'
+        E_EXP = 1 << 14,   // scientific notation identifier: 'e', 'E'
+        E_OTHER = 1 << 15, // other
+    };
+
+    // Try to transform a character to an event.
+    static event get_event(const char ch, const int base)
+    {
+        if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r')
+        {
+            return E_BLANK;
+        }
+        else if (ch == '+' || ch == '-')
+        {
+            return E_SIGN;
+        }
+        else if (char_to_integer(ch, base) != -1)
+        {
+            return E_DIGIT;
+        }
+        else if (ch == '.')
+        {
+            return E_POINT;
+        }
+        else if (ch == 'e' || ch == 'E')
+        {
+            return E_EXP;
+        }
+        return E_OTHER;
+    }
+
+    // Try to transform a character to an integer based on 2-36 base.
+    static int char_to_integer(char digit, int base) // 2 <= base <= 36
+    {
+        static const char* upper_digits = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        static const char* lower_digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+        for (int i = 0; i < base; ++i)
+        {
+            if (digit == upper_digits[i] || digit == lower_digits[i])
+            {
+                return i;
+            }
+        }
+        return -1; // not an integer
+    }
+
+    // Return the characters as std::string_view.
+    std::string_view view() const
+    {
+        return std::string_view(data_, size_);
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty view.
+    StrView() = default;
+
+    /// Create a view of null-terminated characters.
+    StrView(const char* chars)
+        : data_(chars)
+        , size_(std::strlen(chars))
+    {
+    }
+
+    /// Create a view of `size` characters from `data`.
+    StrView(const char* data, int size)
+        : data_(data)
+        , size_(size)
+    {
+    }
+
+    /// Create a view of std::string.
+    StrView(const std::string& string)
+        : data_(string.data())
+        , size_(string.size())
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Determine whether this view is equal to another view.
+    bool operator==(const StrView& that) const
+    {
+        return view() == that.view();
+    }
+
+    /// Compare the view with another view.
+    auto operator<=>(const StrView& that) const
+    {
+        return view() <=> that.view();
+    }
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first char of the view.
+    auto begin() const
+    {
+        return data_;
+    }
+
+    /// Return an iterator to the char following the last char of the view.
+    auto end() const
+    {
+        return data_ + size_;
+    }
+
+    /// Return a reverse iterator to the first char of the reversed view.
+    auto rbegin() const
+    {
+        return std::make_reverse_iterator(end());
+    }
+
+    /// Return a reverse iterator to the char following the last char of the reversed view.
+    auto rend() const
+    {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the const reference to element at the specified position in the view.
+    /// Index can be negative, like Python's string: view[-1] gets the last element.
+    const char& operator[](int index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        return data_[index >= 0 ? index : index + size()];
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of elements in the view.
+    int size() const
+    {
+        return size_;
+    }
+
+    /// Return true if the view contains no elements.
+    bool is_empty() const
+    {
+        return size_ == 0;
+    }
+
+    /// Return const pointer to contents, not null-terminated.
+    const char* data() const
+    {
+        return data_;
+    }
+
+    /// Return the index of the first occurrence of the specified pattern in the specified range [`start`, `stop`).
+    /// Or -1 if the string does not contain the pattern (in the specified range).
+    int find(const StrView& pattern, int start = 0, int stop = INT_MAX) const
+    {
+        if (start > size())
+        {
+            return -1;
+        }
+
+        stop = stop > size() ? size() : stop;
+        auto pos = view().substr(start, stop - start).find(pattern.view());
+
+        return pos == std::string::npos ? -1 : start + int(pos);
+    }
+
+    /// Return `true` if the string contains the specified `pattern` in the specified range [`start`, `stop`).
+    bool contains(const StrView& pattern, int start = 0, int stop = INT_MAX) const
+    {
+        return find(pattern, start, stop) != -1;
+    }
+
+    /// Count the total number of occurrences of the specified `pattern` in the string.
+    int count(const StrView& pattern) const
+    {
+        if (pattern.is_empty())
+        {
+            return size() + 1;
+        }
+
+        int cnt = 0;
+        for (int start = 0; (start = find(pattern, start)) != -1; start += pattern.size())
+        {
+            ++cnt;
+        }
+
+        return cnt;
+    }
+
+    /// Convert the string to a double-precision floating-point decimal number.
+    ///
+    /// If the string is too big to be representable will return `HUGE_VAL`.
+    /// If the string represents NaN will return `NAN`.
+    /// If the string represents Infinity will return `(+-)INFINITY`.
+    ///
+    /// ### Example
+    /// ```
+    /// StrView("233.33").to_decimal(); // 233.33
+    /// StrView("123.456e-3").to_decimal(); // 0.123456
+    /// StrView("1e+600").to_decimal(); // HUGE_VAL
+    /// StrView("nan").to_decimal(); // NAN
+    /// StrView("inf").to_decimal(); // INFINITY
+    /// ```
+    double to_decimal() const
+    {
+        // check infinity or nan
+        static const char* pos_infs[12] = {"inf", "INF", "Inf", "+inf", "+INF", "+Inf", "infinity", "INFINITY", "Infinity", "+infinity", "+INFINITY", "+Infinity"};
+        static const char* neg_infs[6] = {"-inf", "-INF", "-Inf", "-infinity", "-INFINITY", "-Infinity"};
+        static const char* nans[9] = {"nan", "NaN", "NAN", "+nan", "+NaN", "+NAN", "-nan", "-NaN", "-NAN"};
+
+        for (int i = 0; i < 12; ++i)
+        {
+            if (view() == pos_infs[i])
+            {
+                return INFINITY;
+            }
+        }
+        for (int i = 0; i < 6; ++i)
+        {
+            if (view() == neg_infs[i])
+            {
+                return -INFINITY;
+            }
+        }
+        for (int i = 0; i < 9; ++i)
+        {
+            if (view() == nans[i])
+            {
+                return NAN;
+            }
+        }
+
+        // not infinity or nan
+
+        double sign = 1; // default '+'
+        double decimal_part = 0;
+        int decimal_cnt = 0;
+        double exp_sign = 1; // default '+'
+        int exp_part = 0;
+
+        // FSM
+        state st = S_START;
+        for (int i = 0; i < size(); ++i)
+        {
+            event ev = get_event(data_[i], 10);
+            switch (int(st) | int(ev))
+            {
+                case int(S_START) | int(E_BLANK):
+                    st = S_START;
+                    break;
+
+                case int(S_START) | int(E_SIGN):
+                    sign = (data_[i] == '+') ? 1 : -1;
+                    st = S_SIGN;
+                    break;
+
+                case int(S_START) | int(E_POINT):
+                case int(S_SIGN) | int(E_POINT):
+                    st = S_POINT;
+                    break;
+
+                case int(S_START) | int(E_DIGIT):
+                case int(S_SIGN) | int(E_DIGIT):
+                case int(S_INT) | int(E_DIGIT):
+                    decimal_part = decimal_part * 10 + char_to_integer(data_[i], 10);
+                    st = S_INT;
+                    break;
+
+                case int(S_INT) | int(E_POINT):
+                    st = S_DEC;
+                    break;
+
+                case int(S_POINT) | int(E_DIGIT):
+                case int(S_DEC) | int(E_DIGIT):
+                    decimal_part = decimal_part * 10 + char_to_integer(data_[i], 10);
+                    decimal_cnt++;
+                    st = S_DEC;
+                    break;
+
+                case int(S_INT) | int(E_EXP):
+                case int(S_DEC) | int(E_EXP):
+                    st = S_EXP;
+                    break;
+
+                case int(S_EXP) | int(E_SIGN):
+                    exp_sign = (data_[i] == '+') ? 1 : -1;
+                    st = S_EXP_SIGN;
+                    break;
+
+                case int(S_EXP) | int(E_DIGIT):
+                case int(S_EXP_SIGN) | int(E_DIGIT):
+                case int(S_EXP_NUM) | int(E_DIGIT):
+                    exp_part = exp_part * 10 + char_to_integer(data_[i], 10);
+                    st = S_EXP_NUM;
+                    break;
+
+                case int(S_INT) | int(E_BLANK):
+                case int(S_DEC) | int(E_BLANK):
+                case int(S_EXP_NUM) | int(E_BLANK):
+                case int(S_END) | int(E_BLANK):
+                    st = S_END;
+                    break;
+
+                default:
+                    st = S_OTHER;
+                    i = size(); // exit loop
+                    break;
+            }
+        }
+        if (st != S_INT && st != S_DEC && st != S_EXP_NUM && st != S_END)
+        {
+            throw std::runtime_error("Error: Invalid literal for to_decimal().");
+        }
+
+        return sign * ((decimal_part / std::pow(10, decimal_cnt)) * std::pow(10, exp_sign * exp_part));
+    }
+
+    /// Convert the string to an `Int` based on 2-36 `base`.
+    ///
+    /// Numeric character in 36 base: 0, 1, ..., 9, A(10), ..., F(15), G(16), ..., Y(34), Z(35).
+    ///
+    /// ### Example
+    /// ```
+    /// StrView("233").to_integer(); // 233
+    /// StrView("cafebabe").to_integer(16); // 3405691582
+    /// StrView("z").to_integer(36); // 35
+    /// StrView("ffffffffffffffff").to_integer(16); // 18446744073709551615
+    /// ```
+    Int to_integer(int base = 10) const
+    {
+        // check base
+        if (base < 2 || base > 36)
+        {
+            throw std::runtime_error("Error: Invalid base for to_integer().");
+        }
+
+        bool non_negative = true; // default '+'
+        int digits_start = 0, digits_stop = 0;
+
+        // FSM
+        state st = S_START;
+        for (int i = 0; i < size(); ++i)
+        {
+            event ev = get_event(data_[i], base);
+            switch (int(st) | int(ev))
+            {
+                case int(S_START) | int(E_BLANK):
+                    st = S_START;
+                    break;
+
+                case int(S_START) | int(E_SIGN):
+                    non_negative = (data_[i] == '+') ? true : false;
+                    st = S_SIGN;
+                    break;
+
+                case int(S_START) | int(E_DIGIT):
+                case int(S_SIGN) | int(E_DIGIT):
+                    digits_start = i;
+                    digits_stop = i + 1;
+                    st = S_INT;
+                    break;
+
+                case int(S_INT) | int(E_DIGIT):
+                    digits_stop = i + 1;
+                    st = S_INT;
+                    break;
+
+                case int(S_INT) | int(E_BLANK):
+                case int(S_END) | int(E_BLANK):
+                    st = S_END;
+                    break;
+
+                default:
+                    st = S_OTHER;
+                    i = size(); // exit loop
+                    break;
+            }
+        }
+        if (st != S_INT && st != S_END)
+        {
+            throw std::runtime_error("Error: Invalid literal for to_integer().");
+        }
+
+        // convert all digits at once, subquadratic for big inputs
+        Int integer;
+        Int::from_chars(data_ + digits_start, data_ + digits_stop, integer, base);
+
+        return non_negative ? integer : -integer;
+    }
+
+    /// Return `true` if the string begins with the specified string, otherwise return `false`.
+    bool starts_with(const StrView& str) const
+    {
+        return view().starts_with(str.view());
+    }
+
+    /// Return `true` if the string ends with the specified string, otherwise return `false`.
+    bool ends_with(const StrView& str) const
+    {
+        return view().ends_with(str.view());
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return the view of the characters from `start` to `stop`.
+    /// Index can be negative.
+    StrView slice(int start, int stop) const
+    {
+        detail::check_bounds(start, -size(), size());
+        detail::check_bounds(stop, -size() - 1, size() + 1);
+
+        start = start < 0 ? start + size() : start;
+        stop = stop < 0 ? stop + size() : stop;
+
+        return StrView(data_ + start, std::max(stop - start, 0));
+    }
+
+    /// Return the view without leading and trailing characters (default is blank character).
+    StrView strip(const signed char& ch = -1) const
+    {
+        auto stripped = [&](char c)
+        {
+            return ch == -1 ? c <= 0x20 : c == ch;
+        };
+
+        int start = 0;
+        while (start < size() && stripped(data_[start]))
+        {
+            ++start;
+        }
+
+        int stop = size();
+        while (stop > start && stripped(data_[stop - 1]))
+        {
+            --stop;
+        }
+
+        return StrView(data_ + start, stop - start);
+    }
+
+    /// Split the view with separator (default = " ") into views.
+    /// If `keep_empty` is set (default = false), empty views will be retained.
+    ///
+    /// ### Example
+    /// ```
+    /// StrView("one, two, three").split(", "); // ["one", "two", "three"]
+    /// StrView("   1   2   3   ").split(); // ["1", "2", "3"]
+    /// ```
+    List<StrView> split(const StrView& sep = " ", bool keep_empty = false) const
+    {
+        if (sep.is_empty())
+        {
+            throw std::runtime_error("Error: Empty separator.");
+        }
+
+        List<StrView> views;
+        int this_start = 0;
+        for (int patt_start = 0; (patt_start = find(sep, this_start)) != -1; this_start = patt_start + sep.size())
+        {
+            if (!keep_empty && patt_start == this_start) // skip empty view
+            {
+                continue;
+            }
+            views += StrView(data_ + this_start, patt_start - this_start);
+        }
+        if (keep_empty || this_start != size())
+        {
+            views += StrView(data_ + this_start, size() - this_start);
+        }
+
+        return views;
+    }
+
+    /// Lazy range of the parts of a split, see split_iter().
+    class SplitRange : public std::ranges::view_interface<SplitRange>
+    {
+    private:
+        // Characters to split.
+        std::string_view source_;
+
+        // Separator.
+        std::string_view sep_;
+
+        // Whether empty parts are retained.
+        bool keep_empty_ = false;
+
+        // Maximum number of splits, negative for no limit.
+        int maxsplit_ = -1;
+
+    public:
+        /// Forward iterator that finds the next part when incremented.
+        class Iterator
+        {
+        private:
+            // Characters after the current part, not split yet.
+            std::string_view rest_;
+
+            // Current part.
+            std::string_view part_;
+
+            // Separator.
+            std::string_view sep_;
+
+            // Whether empty parts are retained.
+            bool keep_empty_ = false;
+
+            // Remaining number of splits, negative for no limit.
+            int splits_ = -1;
+
+            // Whether the rest has been taken as the last part.
+            bool last_ = true;
+
+            // Whether the iterator is past the last part.
+            bool done_ = true;
+
+            // Move to the next part.
+            void next()
+            {
+                while (!last_)
+                {
+                    const std::size_t pos = splits_ == 0 ? std::string_view::npos : rest_.find(sep_);
+                    if (pos == std::string_view::npos)
+                    {
+                        part_ = rest_;
+                        last_ = true;
+                        done_ = !keep_empty_ && part_.empty();
+                        return;
+                    }
+
+                    part_ = rest_.substr(0, pos);
+                    rest_ = rest_.substr(pos + sep_.size());
+                    if (!keep_empty_ && part_.empty()) // skip empty part, not counted as a split
+                    {
+                        continue;
+                    }
+
+                    if (splits_ > 0 && --splits_ == 0 && !keep_empty_)
+                    {
+                        while (rest_.starts_with(sep_)) // the rest starts after the skipped separators, like Python
+                        {
+                            rest_ = rest_.substr(sep_.size());
+                        }
+                    }
+                    return;
+                }
+
+                done_ = true;
+            }
+
+        public:
+            using value_type = StrView;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+
+            /// Create a past-the-end iterator.
+            Iterator() = default;
+
+            /// Create an iterator to the first part of `source`.
+            Iterator(std::string_view source, std::string_view sep, bool keep_empty, int maxsplit)
+                : rest_(source)
+                , sep_(sep)
+                , keep_empty_(keep_empty)
+                , splits_(maxsplit)
+                , last_(false)
+                , done_(false)
+            {
+                next();
+            }
+
+            /// Return the current part.
+            StrView operator*() const
+            {
+                return StrView(part_.data(), part_.size());
+            }
+
+            /// Move to the next part.
+            Iterator& operator++()
+            {
+                next();
+                return *this;
+            }
+
+            /// Move to the next part and return the old iterator.
+            Iterator operator++(int)
+            {
+                Iterator it = *this;
+                next();
+                return it;
+            }
+
+            /// Determine whether two iterators are at the same part.
+            bool operator==(const Iterator& that) const
+            {
+                return done_ == that.done_ && (done_ || (part_.data() == that.part_.data() && last_ == that.last_));
+            }
+
+            /// Determine whether the iterator is past the last part.
+            bool operator==(std::default_sentinel_t) const
+            {
+                return done_;
+            }
+        };
+
+        /// Create an empty range.
+        SplitRange() = default;
+
+        /// Create the range of the parts of `source` split by `sep`.
+        SplitRange(std::string_view source, std::string_view sep, bool keep_empty, int maxsplit)
+            : source_(source)
+            , sep_(sep)
+            , keep_empty_(keep_empty)
+            , maxsplit_(maxsplit)
+        {
+        }
+
+        /// Return an iterator to the first part.
+        Iterator begin() const
+        {
+            return sep_.empty() ? Iterator() : Iterator(source_, sep_, keep_empty_, maxsplit_); // a default range is empty
+        }
+
+        /// Return the sentinel after the last part.
+        std::default_sentinel_t end() const
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    /// Lazily split the view with separator (default = " "), finding each part only when the iteration reaches it,
+    /// so the caller can stop early and memory doesn't grow with the input.
+    /// If `keep_empty` is set (default = false), empty parts will be retained.
+    /// At most `maxsplit` splits are done if it's non-negative (default = -1), and the rest is the last part.
+    /// The range composes with `std::views`.
+    ///
+    /// ### Example
+    /// ```
+    /// StrView("a b c d").split_iter(" ", false, 2); // "a", "b", "c d"
+    /// StrView("a,b,,c").split_iter(",", true) | std::views::take(3); // "a", "b", ""
+    /// ```
+    SplitRange split_iter(const StrView& sep = " ", bool keep_empty = false, int maxsplit = -1) const
+    {
+        if (sep.is_empty())
+        {
+            throw std::runtime_error("Error: Empty separator.");
+        }
+
+        return SplitRange(view(), sep.view(), keep_empty, maxsplit);
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the view to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const StrView& view)
+    {
+        return os << '"' << view.view() << '"';
+    }
+};
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::StrView> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::StrView& view) const
+    {
+        // same as the hash of Str with the same characters
+        std::size_t hash = pyincpp::detail::hash_bytes(view.data(), view.size());
+        return hash + (hash == 0);
+    }
+};
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<pyincpp::StrView::SplitRange> = true; // iterators don't refer to the range
+
+#endif // STR_VIEW_HPP
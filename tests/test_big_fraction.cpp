@@ -0,0 +1,215 @@
+#include "../sources/big_fraction.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("BigFraction")
+{
+    SECTION("basics")
+    {
+        // BigFraction(long long numerator = 0, long long denominator = 1)
+        BigFraction f1;
+        REQUIRE(f1.numerator() == 0);
+        REQUIRE(f1.denominator() == 1);
+        REQUIRE(f1.is_small());
+        BigFraction f2(6, -4);
+        REQUIRE(f2.numerator() == -3);
+        REQUIRE(f2.denominator() == 2);
+        BigFraction f3(LLONG_MIN, 2);
+        REQUIRE(f3.numerator() == Int(LLONG_MIN) / 2);
+        REQUIRE(!f3.is_small());
+        REQUIRE_THROWS_MATCHES(BigFraction(1, 0), std::runtime_error, Message("Error: Divide by zero."));
+
+        // BigFraction(const Int& numerator, const Int& denominator = 1)
+        BigFraction f4("123456789012345678901234567890", "-1234567890123456789012345678900");
+        REQUIRE(f4.numerator() == -1);
+        REQUIRE(f4.denominator() == 10);
+        REQUIRE(f4.is_small()); // back to machine words after simplification
+        BigFraction f5(Int::pow(2, 100), 3);
+        REQUIRE(f5.numerator() == Int::pow(2, 100));
+        REQUIRE(f5.denominator() == 3);
+        REQUIRE_THROWS_MATCHES(BigFraction(Int(1), Int(0)), std::runtime_error, Message("Error: Divide by zero."));
+
+        // BigFraction(const Fraction& fraction)
+        BigFraction f6(Fraction(3, 4));
+        REQUIRE(f6 == BigFraction(3, 4));
+
+        // BigFraction(F number)
+        REQUIRE(BigFraction(0.0) == BigFraction(0));
+        REQUIRE(BigFraction(-0.75) == BigFraction(-3, 4));
+        REQUIRE(BigFraction(0.1) == BigFraction(3602879701896397, 36028797018963968));
+        REQUIRE(BigFraction(1e30) == BigFraction(Int("1000000000000000019884624838656")));
+        REQUIRE(BigFraction(5e-324) == BigFraction(1, Int::pow(2, 1074)));
+        REQUIRE(BigFraction(0.1f) == BigFraction(13421773, 134217728));
+        REQUIRE_THROWS_MATCHES(BigFraction(NAN), std::runtime_error, Message("Error: Cannot convert NaN or infinity to fraction."));
+    }
+
+    BigFraction zero;
+    BigFraction positive(1, 2);
+    BigFraction negative(-1, 2);
+    BigFraction big(Int::pow(2, 100) + 1, Int::pow(3, 50));
+
+    SECTION("compare")
+    {
+        REQUIRE(zero == zero);
+        REQUIRE(BigFraction(9, 6) == BigFraction(3, 2));
+        REQUIRE(big == BigFraction(Int::pow(2, 100) + 1, Int::pow(3, 50)));
+
+        REQUIRE(zero != positive);
+        REQUIRE(positive != negative);
+        REQUIRE(big != positive);
+
+        REQUIRE(zero > negative);
+        REQUIRE(big > positive);
+        REQUIRE(BigFraction(INT_MAX, 3) > BigFraction(INT_MAX - 1, 3));
+
+        REQUIRE(zero < positive);
+        REQUIRE(-big < negative);
+        REQUIRE(BigFraction(1, Int::pow(10, 30)) < BigFraction(1, Int::pow(10, 29)));
+
+        REQUIRE(zero >= zero);
+        REQUIRE(zero <= positive);
+    }
+
+    SECTION("examination")
+    {
+        REQUIRE(double(positive) == 0.5);
+        REQUIRE(double(negative) == -0.5);
+        REQUIRE(double(BigFraction(2, 3)) == Approx(2.0 / 3.0));
+        REQUIRE(double(big) == Approx(1267650600228229401496703205377.0 / 717897987691852588770249.0));
+        REQUIRE(double(BigFraction(1, Int::pow(10, 400))) == Approx(0.0));
+        REQUIRE(double(BigFraction(Int::pow(10, 300) + 1, Int::pow(10, 299))) == Approx(10.0));
+    }
+
+    SECTION("inc_dec")
+    {
+        REQUIRE(++BigFraction(-1) == BigFraction(0));
+        REQUIRE(++BigFraction(INT_MAX) == BigFraction(INT_MAX + 1ll));
+        REQUIRE(--BigFraction(0) == BigFraction(-1));
+        REQUIRE(--BigFraction(-INT_MAX) == BigFraction(-INT_MAX - 1ll));
+    }
+
+    SECTION("unary")
+    {
+        REQUIRE(+positive == positive);
+        REQUIRE(-positive == negative);
+        REQUIRE(-(-big) == big);
+        REQUIRE(negative.abs() == positive);
+        REQUIRE((-big).abs() == big);
+    }
+
+    SECTION("arithmetic")
+    {
+        REQUIRE(positive + negative == zero);
+        REQUIRE(positive - negative == BigFraction(1));
+        REQUIRE(positive * negative == BigFraction(-1, 4));
+        REQUIRE(positive / negative == BigFraction(-1));
+        REQUIRE(BigFraction(7, 2) % BigFraction(1, 3) == BigFraction(1, 6));
+        REQUIRE_THROWS_MATCHES(positive / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE_THROWS_MATCHES(positive % zero, std::runtime_error, Message("Error: Divide by zero."));
+
+        // overflow of int moves to Int, and back when it fits again
+        BigFraction x(INT_MAX, 2);
+        x *= x;
+        REQUIRE(x == BigFraction(Int(INT_MAX) * INT_MAX, 4));
+        REQUIRE(!x.is_small());
+        x /= BigFraction(INT_MAX);
+        REQUIRE(x == BigFraction(INT_MAX, 4));
+        REQUIRE(x.is_small());
+
+        BigFraction y(1, 6);
+        REQUIRE((y += BigFraction(1, 3)) == positive);
+        REQUIRE((y -= positive) == zero);
+        REQUIRE((y += big) == big);
+        REQUIRE((y *= BigFraction(Int::pow(3, 50), Int::pow(2, 100) + 1)) == BigFraction(1));
+        REQUIRE(y.is_small());
+        REQUIRE((y /= -big) == BigFraction(-Int::pow(3, 50), Int::pow(2, 100) + 1));
+        REQUIRE(y.denominator().is_positive());
+
+        REQUIRE(big - big == zero);
+        REQUIRE(big / big == BigFraction(1));
+        REQUIRE(BigFraction(Int::pow(2, 70) + 1, 3) % BigFraction(5, 7) == BigFraction(5, 21));
+
+        // harmonic number H(100)
+        BigFraction sum;
+        for (int i = 1; i <= 100; ++i)
+        {
+            sum += BigFraction(1, i);
+        }
+        REQUIRE(sum == BigFraction("14466636279520351160221518043104131447711", "2788815009188499086581352357412492142272"));
+    }
+
+    SECTION("gcd_lcm")
+    {
+        REQUIRE(BigFraction::gcd(BigFraction(1, 2), BigFraction(3, 4)) == BigFraction(1, 4));
+        REQUIRE(BigFraction::gcd(BigFraction(-1, 2), BigFraction(-3, 4)) == BigFraction(1, 4));
+        REQUIRE(BigFraction::lcm(BigFraction(1, 2), BigFraction(3, 4)) == BigFraction(3, 2));
+        REQUIRE(BigFraction::lcm(zero, positive) == zero);
+        REQUIRE(BigFraction::gcd(big, big * 2) == big);
+    }
+
+    SECTION("sum")
+    {
+        std::vector<BigFraction> empty;
+        REQUIRE(BigFraction::sum(empty.begin(), empty.end()) == zero);
+
+        std::vector<BigFraction> harmonic;
+        for (int i = 1; i <= 100; ++i)
+        {
+            harmonic.push_back(BigFraction(1, i));
+        }
+        REQUIRE(BigFraction::sum(harmonic.begin(), harmonic.end()) == BigFraction("14466636279520351160221518043104131447711", "2788815009188499086581352357412492142272"));
+
+        List<BigFraction> list = {big, -big, positive};
+        REQUIRE(BigFraction::sum(list.begin(), list.end()) == positive);
+    }
+
+    SECTION("limit_denominator")
+    {
+        const BigFraction pi(3.141592653589793);
+        REQUIRE(pi.limit_denominator(1000) == BigFraction(355, 113));
+        REQUIRE((-pi).limit_denominator(1000) == BigFraction(-355, 113));
+        REQUIRE(pi.limit_denominator(1000000) == BigFraction(3126535, 995207));
+        REQUIRE(positive.limit_denominator(1) == zero);
+        REQUIRE(negative.limit_denominator(1) == BigFraction(-1));
+        REQUIRE(BigFraction(Int::pow(10, 30) + 1, Int::pow(10, 20)).limit_denominator(100000) == BigFraction(Int::pow(10, 10)));
+        REQUIRE(big.limit_denominator(Int::pow(10, 30)) == big);
+        REQUIRE_THROWS_MATCHES(big.limit_denominator(0), std::runtime_error, Message("Error: Require max_den >= 1 for limit_denominator(max_den)."));
+
+        // as_integer_ratio()
+        REQUIRE(BigFraction(0.1).as_integer_ratio() == std::pair(Int(3602879701896397), Int(36028797018963968)));
+        REQUIRE(big.as_integer_ratio() == std::pair(Int::pow(2, 100) + 1, Int::pow(3, 50)));
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+        oss << zero << ' ' << negative << ' ' << big << ' ' << BigFraction(Int::pow(10, 20));
+        REQUIRE(oss.str() == "0 -1/2 1267650600228229401496703205377/717897987691852588770249 100000000000000000000");
+    }
+
+    SECTION("input")
+    {
+        BigFraction f1, f2, f3;
+        std::istringstream("  +1/-2  \n  123456789012345678901234567890 \t 0") >> f1 >> f2 >> f3;
+
+        REQUIRE(f1 == BigFraction(-1, 2));
+        REQUIRE(f2 == BigFraction("123456789012345678901234567890"));
+        REQUIRE(f3 == zero);
+
+        BigFraction err;
+        REQUIRE_THROWS_MATCHES(std::istringstream("z1/2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("1/") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("1/2/3") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("0/0") >> err, std::runtime_error, Message("Error: Divide by zero."));
+    }
+
+    SECTION("hash")
+    {
+        std::hash<BigFraction> hash;
+        REQUIRE(hash(BigFraction(2, 4)) == hash(positive));
+        REQUIRE(hash(big) == hash(BigFraction(Int::pow(2, 100) + 1, Int::pow(3, 50))));
+        REQUIRE(hash(positive) != hash(negative));
+    }
+}
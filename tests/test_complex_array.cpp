@@ -0,0 +1,155 @@
+#include "../sources/complex_array.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("ComplexArray")
+{
+    SECTION("basics")
+    {
+        // ComplexArray()
+        ComplexArray a1;
+        REQUIRE(a1.size() == 0);
+        REQUIRE(a1.is_empty());
+
+        // ComplexArray(int size, const Complex& value = 0)
+        ComplexArray a2(3, Complex(1, 2));
+        REQUIRE(a2.size() == 3);
+        REQUIRE(a2[2] == Complex(1, 2));
+
+        // ComplexArray(const std::initializer_list<Complex>& init)
+        ComplexArray a3 = {1, Complex(2, 3)};
+        REQUIRE(a3[1] == Complex(2, 3));
+
+        // ComplexArray(const List<Complex>& list)
+        ComplexArray a4(List<Complex>({1, Complex(2, 3)}));
+        REQUIRE(a4 == a3);
+
+        // ComplexArray(const List<double>& real, const List<double>& imag)
+        ComplexArray a5({1, 2}, {0, 3});
+        REQUIRE(a5 == a3);
+        REQUIRE_THROWS_MATCHES(ComplexArray({1, 2}, {0}), std::runtime_error, Message("Error: The sizes of two arrays are different."));
+    }
+
+    // seven elements, one AVX2 block and a scalar tail
+    ComplexArray a = {Complex(1, 2), Complex(-1, 2), Complex(3, -4), Complex(0, 1), Complex(2), Complex(-0.5, 0.5), Complex(1, 1)};
+    ComplexArray b = {Complex(2, 1), Complex(1, -1), Complex(1, 1), Complex(0, -2), Complex(4), Complex(1, 1), Complex(-1, 3)};
+
+    // elementwise reference by Complex
+    auto each = [&](auto op)
+    {
+        List<Complex> result;
+        for (int i = 0; i < a.size(); ++i)
+        {
+            result += op(a[i], b[i]);
+        }
+        return ComplexArray(result);
+    };
+
+    SECTION("compare")
+    {
+        REQUIRE(a == a);
+        REQUIRE(a != b);
+        REQUIRE(a != ComplexArray());
+        REQUIRE(ComplexArray(2) == ComplexArray({0, 0}));
+    }
+
+    SECTION("access")
+    {
+        REQUIRE(a[0] == Complex(1, 2));
+        REQUIRE(a[-1] == Complex(1, 1));
+        REQUIRE_THROWS_MATCHES(a[7], std::runtime_error, Message("Error: Index out of range."));
+
+        a.set(-2, Complex(5, 6));
+        REQUIRE(a[5] == Complex(5, 6));
+        REQUIRE_THROWS_MATCHES(a.set(-8, 0), std::runtime_error, Message("Error: Index out of range."));
+
+        a.real()[0] = 9;
+        REQUIRE(a[0] == Complex(9, 2));
+        REQUIRE(std::as_const(a).imag()[2] == -4);
+        REQUIRE(a.to_list()[0] == Complex(9, 2));
+    }
+
+    SECTION("arithmetic")
+    {
+        REQUIRE(a + b == each(std::plus<Complex>()));
+        REQUIRE(a - b == each(std::minus<Complex>()));
+        REQUIRE(a * b == each(std::multiplies<Complex>()));
+        REQUIRE(a / b == each(std::divides<Complex>()));
+        REQUIRE(+a == a);
+        REQUIRE(-(-a) == a);
+        REQUIRE(a - a == ComplexArray(7));
+
+        ComplexArray c = a;
+        c *= c;
+        REQUIRE(c == a * a);
+        c /= a;
+        REQUIRE(c == a);
+
+        REQUIRE_THROWS_MATCHES(a + ComplexArray(3), std::runtime_error, Message("Error: The sizes of two arrays are different."));
+        REQUIRE_THROWS_MATCHES(a / ComplexArray(7), std::runtime_error, Message("Error: Divide by zero."));
+    }
+
+    SECTION("production")
+    {
+        List<double> abs = a.abs();
+        List<double> arg = a.arg();
+        ComplexArray conjugate = a.conjugate();
+        for (int i = 0; i < a.size(); ++i)
+        {
+            REQUIRE(abs[i] == Approx(a[i].abs()));
+            REQUIRE(arg[i] == Approx(a[i].arg()));
+            REQUIRE(conjugate[i] == a[i].conjugate());
+        }
+    }
+
+    SECTION("pow")
+    {
+        REQUIRE(ComplexArray::pow(a, 0) == ComplexArray(7, 1));
+        REQUIRE(ComplexArray::pow(a, 1) == a);
+        REQUIRE(ComplexArray::pow(a, 3) == a * a * a);
+        REQUIRE(ComplexArray::pow(a, -2) == ComplexArray(7, 1) / (a * a));
+        REQUIRE(ComplexArray::pow(ComplexArray(5), 2) == ComplexArray(5));
+        REQUIRE_THROWS_MATCHES(ComplexArray::pow(ComplexArray(5), -1), std::runtime_error, Message("Error: Divide by zero."));
+
+        ComplexArray p = ComplexArray::pow(a, Complex(0.5, 1));
+        for (int i = 0; i < a.size(); ++i)
+        {
+            REQUIRE(p[i] == Complex::pow(a[i], Complex(0.5, 1)));
+        }
+    }
+
+    SECTION("elementary")
+    {
+        ComplexArray exp = ComplexArray::exp(a);
+        ComplexArray log = ComplexArray::log(a);
+        ComplexArray sqrt = ComplexArray::sqrt(a);
+        ComplexArray sin = ComplexArray::sin(a);
+        ComplexArray cos = ComplexArray::cos(a);
+        for (int i = 0; i < a.size(); ++i)
+        {
+            REQUIRE(exp[i] == Complex::exp(a[i]));
+            REQUIRE(log[i] == Complex::log(a[i]));
+            REQUIRE(sqrt[i] == Complex::sqrt(a[i]));
+            REQUIRE(sin[i] == Complex::sin(a[i]));
+            REQUIRE(cos[i] == Complex::cos(a[i]));
+        }
+        REQUIRE_THROWS_MATCHES(ComplexArray::log(ComplexArray(1)), std::runtime_error, Message("Error: Math domain error."));
+    }
+
+    SECTION("reduction")
+    {
+        REQUIRE(a.sum() == Complex(5.5, 2.5));
+        REQUIRE(ComplexArray().sum() == Complex(0));
+        REQUIRE(a.dot(b) == each(std::multiplies<Complex>()).sum());
+        REQUIRE_THROWS_MATCHES(a.dot(ComplexArray()), std::runtime_error, Message("Error: The sizes of two arrays are different."));
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+        oss << ComplexArray() << ' ' << ComplexArray({Complex(1, 2), Complex(3, -4)});
+        REQUIRE(oss.str() == "[] [(1+2j), (3-4j)]");
+    }
+}
@@ -0,0 +1,110 @@
+#include "../sources/fft.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+// Discrete Fourier transform by definition.
+static List<Complex> dft(const List<Complex>& list)
+{
+    const int n = list.size();
+    List<Complex> result;
+    for (int k = 0; k < n; ++k)
+    {
+        Complex sum;
+        for (int t = 0; t < n; ++t)
+        {
+            const double angle = -2 * std::numbers::pi * (1ll * k * t % n) / n;
+            sum += list[t] * Complex(std::cos(angle), std::sin(angle));
+        }
+        result += sum;
+    }
+    return result;
+}
+
+// Determine whether two lists of complexes are close.
+static bool close(const List<Complex>& a, const List<Complex>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < a.size(); ++i)
+    {
+        if ((a[i] - b[i]).abs() > 1e-9 * (1 + b[i].abs()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Return a list of `n` pseudo-random complexes.
+static List<Complex> samples(int n)
+{
+    List<Complex> list;
+    for (int i = 0; i < n; ++i)
+    {
+        list += Complex(std::sin(i * 1.3 + 0.2), std::cos(i * 0.7) - 0.5);
+    }
+    return list;
+}
+
+TEST_CASE("FFT")
+{
+    SECTION("plan")
+    {
+        REQUIRE(FFT::plan(8).size() == 8);
+        REQUIRE(&FFT::plan(8) == &FFT::plan(8));
+        REQUIRE(&FFT::plan(12) == &FFT::plan(12));
+        REQUIRE_THROWS_MATCHES(FFT::plan(0), std::runtime_error, Message("Error: Require size >= 1 for plan(size)."));
+
+        ComplexArray array(4);
+        REQUIRE_THROWS_MATCHES(FFT::plan(8).forward(array), std::runtime_error, Message("Error: The sizes of the array and the plan are different."));
+    }
+
+    SECTION("fft")
+    {
+        // powers of two with even and odd exponents, and Bluestein sizes
+        for (int n : {1, 2, 4, 8, 16, 32, 64, 256, 3, 5, 6, 7, 12, 100, 127})
+        {
+            List<Complex> list = samples(n);
+            REQUIRE(close(FFT::fft(list), dft(list)));
+            REQUIRE(close(FFT::ifft(FFT::fft(list)), list));
+        }
+
+        REQUIRE(close(FFT::fft({1, 1, 1, 1}), {4, 0, 0, 0}));
+        REQUIRE(close(FFT::fft({0, 1, 0, 0}), {1, Complex(0, -1), -1, Complex(0, 1)}));
+    }
+
+    SECTION("in_place")
+    {
+        List<Complex> list = samples(1000);
+        ComplexArray array(list);
+        FFT::fft(array);
+        REQUIRE(close(array.to_list(), dft(list)));
+        FFT::ifft(array);
+        REQUIRE(close(array.to_list(), list));
+
+        const FFT& plan = FFT::plan(1000);
+        plan.forward(array);
+        plan.inverse(array);
+        REQUIRE(close(array.to_list(), list));
+    }
+
+    SECTION("rfft")
+    {
+        for (int n : {1, 2, 3, 8, 10, 15, 64, 100})
+        {
+            List<double> real;
+            List<Complex> list;
+            for (int i = 0; i < n; ++i)
+            {
+                real += std::sin(i * 0.9) + i % 3;
+                list += real[i];
+            }
+            REQUIRE(close(FFT::rfft(real), dft(list).slice(0, n / 2 + 1)));
+        }
+    }
+}
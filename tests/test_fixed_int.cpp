@@ -0,0 +1,172 @@
+#include "../sources/fixed_int.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+using Int128 = FixedInt<128>;
+using Int256 = FixedInt<256>;
+
+TEST_CASE("FixedInt")
+{
+    SECTION("basics")
+    {
+        // FixedInt(T n = 0)
+        Int128 int1;
+        REQUIRE(int1.digits() == 0);
+        REQUIRE(int1.is_zero());
+        Int128 int2(-123456789);
+        REQUIRE(int2.digits() == 9);
+        REQUIRE(int2.is_negative());
+
+        // FixedInt(const char* chars)
+        Int128 int3("123456789000");
+        REQUIRE(int3.digits() == 12);
+        REQUIRE(int3.is_positive());
+        REQUIRE(Int128("-170141183460469231731687303715884105728") == Int128::min());
+        REQUIRE(Int128("170141183460469231731687303715884105728") == Int128::min()); // wrap around
+        REQUIRE_THROWS_MATCHES(Int128("hello"), std::runtime_error, Message("Error: Wrong integer literal."));
+        REQUIRE_THROWS_MATCHES(Int128("-"), std::runtime_error, Message("Error: Wrong integer literal."));
+
+        // constant evaluation
+        static_assert(Int128(1) + Int128(2) == 3);
+        static_assert(Int128("18446744073709551616") * Int128("18446744073709551616") == 0); // 2^128 wraps around
+        static_assert(Int256::pow(3, 100, "1000000007") == 886041711);
+        static_assert(Int128::sqrt("85070591730234615865843651857942052864") == Int128("9223372036854775808"));
+        static_assert(Int128("18446744073709551557").is_prime());
+    }
+
+    Int128 zero;
+    Int128 positive = "18446744073709551617";  // 2^64+1
+    Int128 negative = "-18446744073709551617"; // -(2^64+1)
+
+    SECTION("compare")
+    {
+        REQUIRE(zero == zero);
+        REQUIRE(positive != negative);
+        REQUIRE(negative < zero);
+        REQUIRE(negative < positive);
+        REQUIRE(zero < positive);
+        REQUIRE(Int128::min() < Int128::max());
+        REQUIRE(Int128(-1) < Int128(0));
+        REQUIRE(Int128(0xffffffffLL) < Int128(0x100000000LL));
+    }
+
+    SECTION("examination")
+    {
+        REQUIRE(Int128::max().digits() == 39);
+        REQUIRE(zero.is_even());
+        REQUIRE(positive.is_odd());
+        REQUIRE(negative.is_odd());
+
+        REQUIRE(!Int128(1).is_prime());
+        REQUIRE(Int128(2).is_prime());
+        REQUIRE(Int128(37).is_prime());
+        REQUIRE(!Int128(3215031751).is_prime()); // strong pseudoprime to bases 2, 3, 5, 7
+        REQUIRE(Int128("170141183460469231731687303715884105727").is_prime()); // 2^127-1
+        REQUIRE(!Int128("4951760154835678088235319297").is_prime()); // (2^61-1)*(2^31-1)
+    }
+
+    SECTION("arithmetic")
+    {
+        REQUIRE(positive + negative == zero);
+        REQUIRE(positive - negative == Int128("36893488147419103234"));
+        REQUIRE(positive * negative == Int128("-36893488147419103233")); // wrap around
+        REQUIRE(Int128::max() + 1 == Int128::min());
+        REQUIRE(-Int128::min() == Int128::min());
+        REQUIRE(++Int128(0xffffffffLL) == Int128(0x100000000LL));
+        REQUIRE(--Int128(0) == -1);
+
+        REQUIRE(Int128(7) / 2 == 3);
+        REQUIRE(Int128(-7) / 2 == -3);
+        REQUIRE(Int128(7) % -2 == 1);
+        REQUIRE(Int128(-7) % 2 == -1);
+        REQUIRE(positive.divmod(negative) == std::pair{Int128(-1), Int128(0)});
+        REQUIRE_THROWS_MATCHES(positive / zero, std::runtime_error, Message("Error: Divide by zero."));
+
+        // compare with Int
+        for (int i = 0; i < 1000; ++i)
+        {
+            Int a = Int::random(Int::random(1, 38).to_number()), b = Int::random(Int::random(1, 38).to_number());
+            Int c = a * b + Int::random(Int::random(1, 38).to_number());
+            a = i % 2 ? -a : a;
+            b = i % 3 ? b : -b;
+            Int256 x(a), y(b), z(c);
+            REQUIRE(Int(x * y) == a * b);
+            REQUIRE(Int(z / y) == c / b);
+            REQUIRE(Int(z % y) == c % b);
+            REQUIRE(Int(Int256::pow(x, 12345, y)) == Int::pow(a, 12345, b));
+        }
+    }
+
+    SECTION("bitwise")
+    {
+        REQUIRE((Int128(0b1100) & Int128(0b1010)) == 0b1000);
+        REQUIRE((Int128(0b1100) | Int128(0b1010)) == 0b1110);
+        REQUIRE((Int128(0b1100) ^ Int128(0b1010)) == 0b0110);
+        REQUIRE(~zero == -1);
+        REQUIRE((Int128(1) << 64) == Int128("18446744073709551616"));
+        REQUIRE((Int128(1) << 127) == Int128::min());
+        REQUIRE((Int128::min() >> 127) == -1);
+        REQUIRE((positive >> 64) == 1);
+        REQUIRE((negative >> 1) == Int128("-9223372036854775809"));
+    }
+
+    SECTION("pow")
+    {
+        REQUIRE(Int128::pow(2, 127) == Int128::min());
+        REQUIRE(Int128::pow(-3, 3) == -27);
+        REQUIRE(Int128::pow(-1, -1) == -1);
+        REQUIRE(Int128::pow(2, -1) == 0);
+        REQUIRE(Int(Int128::pow(Int128::max() - 1, Int128::max(), Int128::max())) == Int::pow(Int(Int128::max()) - 1, Int(Int128::max()), Int(Int128::max())));
+        REQUIRE_THROWS_MATCHES(Int128::pow(0, -1), std::runtime_error, Message("Error: Math domain error."));
+    }
+
+    SECTION("sqrt")
+    {
+        REQUIRE(Int128::sqrt(0) == 0);
+        REQUIRE(Int128::sqrt(15) == 3);
+        REQUIRE(Int128::sqrt(16) == 4);
+        REQUIRE(Int128::sqrt(Int128::max()) == Int128("13043817825332782212"));
+        REQUIRE_THROWS_MATCHES(Int128::sqrt(-1), std::runtime_error, Message("Error: Require n >= 0 for sqrt(n)."));
+    }
+
+    SECTION("gcd_lcm")
+    {
+        REQUIRE(Int128::gcd(0, 0) == 0);
+        REQUIRE(Int128::gcd(-12, 18) == 6);
+        REQUIRE(Int128::gcd(positive, positive * 3) == positive);
+        REQUIRE(Int128::lcm(4, -6) == 12);
+        REQUIRE(Int128::lcm(0, 6) == 0);
+    }
+
+    SECTION("convert")
+    {
+        REQUIRE(Int(positive) == Int("18446744073709551617"));
+        REQUIRE(Int(Int128::min()) == -Int::pow(2, 127));
+        REQUIRE(Int128(Int::pow(2, 128) + 5) == 5);
+        REQUIRE(Int128(-Int::pow(2, 128) - 5) == -5);
+
+        REQUIRE(negative.to_number<long long>() == -1);
+        REQUIRE(positive.to_number<double>() == Approx(18446744073709551617.0));
+        REQUIRE(negative.to_string() == "-18446744073709551617");
+        REQUIRE(negative.to_string(16) == "-10000000000000001");
+        REQUIRE(zero.to_string(2) == "0");
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+        oss << zero << ' ' << positive << ' ' << negative << ' ' << Int128::min();
+        REQUIRE(oss.str() == "0 18446744073709551617 -18446744073709551617 -170141183460469231731687303715884105728");
+    }
+
+    SECTION("input")
+    {
+        Int128 int1, int2;
+        std::istringstream("+123\n-456") >> int1 >> int2;
+
+        REQUIRE(int1 == 123);
+        REQUIRE(int2 == -456);
+    }
+}
@@ -1,276 +1,350 @@
-#include "../sources/fraction.hpp"
-
-#include "tool.hpp"
-
-using namespace pyincpp;
-
-TEST_CASE("Fraction")
-{
-    SECTION("basics")
-    {
-        // Fraction(int numerator = 0, int denominator = 1)
-        Fraction f1;
-        REQUIRE(f1.numerator() == 0);
-        REQUIRE(f1.denominator() == 1);
-        Fraction f2(2);
-        REQUIRE(f2.numerator() == 2);
-        REQUIRE(f2.denominator() == 1);
-        Fraction f3(2, 3);
-        REQUIRE(f3.numerator() == 2);
-        REQUIRE(f3.denominator() == 3);
-        Fraction f4(0, 9);
-        REQUIRE(f4.numerator() == 0);
-        REQUIRE(f4.denominator() == 1);
-        REQUIRE_THROWS_MATCHES(Fraction(1, 0), std::runtime_error, Message("Error: Divide by zero."));
-
-        // Fraction(double number)
-        Fraction f5(0.0);
-        REQUIRE(f5.numerator() == 0);
-        REQUIRE(f5.denominator() == 1);
-        Fraction f6(1.1);
-        REQUIRE(f6.numerator() == 11);
-        REQUIRE(f6.denominator() == 10);
-        Fraction f7(1234.56789);
-        REQUIRE(f7.numerator() == 123456789);
-        REQUIRE(f7.denominator() == 100000);
-        Fraction f8(0.75);
-        REQUIRE(f8.numerator() == 3);
-        REQUIRE(f8.denominator() == 4);
-        Fraction f9(-22.33);
-        REQUIRE(f9.numerator() == -2233);
-        REQUIRE(f9.denominator() == 100);
-        Fraction f10(-1.2);
-        REQUIRE(f10.numerator() == -6);
-        REQUIRE(f10.denominator() == 5);
-
-        // Fraction(const Fraction& that)
-        Fraction f11(f10);
-        REQUIRE(f11.numerator() == -6);
-        REQUIRE(f11.denominator() == 5);
-
-        // Fraction(Fraction&& that)
-        Fraction f12(std::move(f11));
-        REQUIRE(f12.numerator() == -6);
-        REQUIRE(f12.denominator() == 5);
-
-        // ~Fraction()
-    }
-
-    Fraction zero;
-    Fraction positive(1, 2);
-    Fraction negative(-1, 2);
-
-    SECTION("compare")
-    {
-        REQUIRE(zero == zero);
-        REQUIRE(Fraction(9, 6) == Fraction(3, 2));
-
-        REQUIRE(zero != positive);
-        REQUIRE(positive != negative);
-
-        REQUIRE(zero > negative);
-        REQUIRE(Fraction(1, 2) > Fraction(1, 3));
-
-        REQUIRE(zero < positive);
-        REQUIRE(Fraction(1, 4) < Fraction(1, 3));
-
-        REQUIRE(zero >= zero);
-        REQUIRE(zero >= negative);
-
-        REQUIRE(zero <= zero);
-        REQUIRE(zero <= positive);
-    }
-
-    SECTION("assignment")
-    {
-        positive = negative; // copy
-        REQUIRE(positive == Fraction(-1, 2));
-        REQUIRE(negative == Fraction(-1, 2));
-
-        zero = std::move(negative); // move
-        REQUIRE(zero == Fraction(-1, 2));
-        REQUIRE(negative == Fraction());
-    }
-
-    SECTION("examination")
-    {
-        REQUIRE(double(Fraction(0, 2)) == Approx(0.0));
-        REQUIRE(double(Fraction(1, 2)) == Approx(0.5));
-        REQUIRE(double(Fraction(2, 3)) == Approx(2.0 / 3.0));
-        REQUIRE(double(Fraction(1, -2)) == Approx(-0.5));
-
-        REQUIRE(zero.numerator() == 0);
-        REQUIRE(positive.numerator() == 1);
-        REQUIRE(negative.numerator() == -1);
-
-        REQUIRE(zero.denominator() == 1);
-        REQUIRE(positive.denominator() == 2);
-        REQUIRE(negative.denominator() == 2);
-    }
-
-    SECTION("inc_dec")
-    {
-        // operator++()
-        REQUIRE(++Fraction(-1) == Fraction(0));
-        REQUIRE(++Fraction(0) == Fraction(1));
-        REQUIRE(++Fraction(1) == Fraction(2));
-        REQUIRE(++Fraction(99999) == Fraction(100000));
-
-        // operator--()
-        REQUIRE(--Fraction(-1) == Fraction(-2));
-        REQUIRE(--Fraction(0) == Fraction(-1));
-        REQUIRE(--Fraction(1) == Fraction(0));
-        REQUIRE(--Fraction(100000) == Fraction(99999));
-    }
-
-    SECTION("unary")
-    {
-        REQUIRE(+zero == Fraction(0));
-        REQUIRE(+positive == Fraction(1, 2));
-        REQUIRE(+negative == Fraction(-1, 2));
-
-        REQUIRE(-zero == Fraction(0));
-        REQUIRE(-positive == Fraction(-1, 2));
-        REQUIRE(-negative == Fraction(1, 2));
-
-        REQUIRE(zero.abs() == Fraction(0));
-        REQUIRE(positive.abs() == Fraction(1, 2));
-        REQUIRE(negative.abs() == Fraction(1, 2));
-    }
-
-    SECTION("plus")
-    {
-        REQUIRE(positive + positive == Fraction(1));
-        REQUIRE(positive + zero == Fraction(1, 2));
-        REQUIRE(positive + negative == Fraction(0));
-
-        REQUIRE(negative + positive == Fraction(0));
-        REQUIRE(negative + zero == Fraction(-1, 2));
-        REQUIRE(negative + negative == Fraction(-1));
-
-        REQUIRE(zero + positive == Fraction(1, 2));
-        REQUIRE(zero + zero == Fraction(0));
-        REQUIRE(zero + negative == Fraction(-1, 2));
-    }
-
-    SECTION("minus")
-    {
-        REQUIRE(positive - positive == Fraction(0));
-        REQUIRE(positive - zero == Fraction(1, 2));
-        REQUIRE(positive - negative == Fraction(1));
-
-        REQUIRE(negative - positive == Fraction(-1));
-        REQUIRE(negative - zero == Fraction(-1, 2));
-        REQUIRE(negative - negative == Fraction(0));
-
-        REQUIRE(zero - positive == Fraction(-1, 2));
-        REQUIRE(zero - zero == Fraction(0));
-        REQUIRE(zero - negative == Fraction(1, 2));
-    }
-
-    SECTION("times")
-    {
-        REQUIRE(positive * positive == Fraction(1, 4));
-        REQUIRE(positive * zero == Fraction(0));
-        REQUIRE(positive * negative == Fraction(-1, 4));
-
-        REQUIRE(negative * positive == Fraction(-1, 4));
-        REQUIRE(negative * zero == Fraction(0));
-        REQUIRE(negative * negative == Fraction(1, 4));
-
-        REQUIRE(zero * positive == Fraction(0));
-        REQUIRE(zero * zero == Fraction(0));
-        REQUIRE(zero * negative == Fraction(0));
-    }
-
-    SECTION("divide")
-    {
-        REQUIRE(positive / positive == Fraction(1));
-        REQUIRE_THROWS_MATCHES(positive / zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(positive / negative == Fraction(-1));
-
-        REQUIRE(negative / positive == Fraction(-1));
-        REQUIRE_THROWS_MATCHES(negative / zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(negative / negative == Fraction(1));
-
-        REQUIRE(zero / positive == Fraction(0));
-        REQUIRE_THROWS_MATCHES(zero / zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(zero / negative == Fraction(0));
-    }
-
-    SECTION("mod")
-    {
-        REQUIRE(positive % positive == Fraction(0));
-        REQUIRE_THROWS_MATCHES(positive % zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(positive % negative == Fraction(0));
-
-        REQUIRE(negative % positive == Fraction(0));
-        REQUIRE_THROWS_MATCHES(negative % zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(negative % negative == Fraction(0));
-
-        REQUIRE(zero % positive == Fraction(0));
-        REQUIRE_THROWS_MATCHES(zero % zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(zero % negative == Fraction(0));
-    }
-
-    SECTION("gcd_lcm")
-    {
-        // gcd()
-        REQUIRE(Fraction::gcd(Fraction(0), Fraction(0)) == Fraction(0));
-        REQUIRE(Fraction::gcd(Fraction(0), Fraction(1)) == Fraction(1));
-        REQUIRE(Fraction::gcd(Fraction(1), Fraction(0)) == Fraction(1));
-        REQUIRE(Fraction::gcd(Fraction(1), Fraction(1)) == Fraction(1));
-
-        REQUIRE(Fraction::gcd(Fraction(1, 2), Fraction(3, 4)) == Fraction(1, 4));
-        REQUIRE(Fraction::gcd(Fraction(3, 4), Fraction(1, 6)) == Fraction(1, 12));
-        REQUIRE(Fraction::gcd(Fraction(233, 2333), Fraction(7, 77)) == Fraction(1, 25663));
-        REQUIRE(Fraction::gcd(Fraction(-1, 2), Fraction(-3, 4)) == Fraction(1, 4));
-
-        // lcm()
-        REQUIRE(Fraction::lcm(Fraction(0), Fraction(0)) == Fraction(0));
-        REQUIRE(Fraction::lcm(Fraction(0), Fraction(1)) == Fraction(0));
-        REQUIRE(Fraction::lcm(Fraction(1), Fraction(0)) == Fraction(0));
-        REQUIRE(Fraction::lcm(Fraction(1), Fraction(1)) == Fraction(1));
-
-        REQUIRE(Fraction::lcm(Fraction(1, 2), Fraction(3, 4)) == Fraction(3, 2));
-        REQUIRE(Fraction::lcm(Fraction(3, 4), Fraction(1, 6)) == Fraction(3, 2));
-        REQUIRE(Fraction::lcm(Fraction(233, 2333), Fraction(7, 77)) == Fraction(233));
-        REQUIRE(Fraction::lcm(Fraction(-1, 2), Fraction(-3, 4)) == Fraction(3, 2));
-    }
-
-    SECTION("print")
-    {
-        std::ostringstream oss;
-
-        oss << zero;
-        REQUIRE(oss.str() == "0");
-        oss.str("");
-
-        oss << positive;
-        REQUIRE(oss.str() == "1/2");
-        oss.str("");
-
-        oss << negative;
-        REQUIRE(oss.str() == "-1/2");
-        oss.str("");
-    }
-
-    SECTION("input")
-    {
-        Fraction f1, f2, f3, f4;
-        std::istringstream("  +1/-2  \n  233 \t 1234/4321  0") >> f1 >> f2 >> f3 >> f4;
-
-        REQUIRE(f1 == Fraction(-1, 2));
-        REQUIRE(f2 == Fraction(233));
-        REQUIRE(f3 == Fraction(1234, 4321));
-        REQUIRE(f4 == Fraction(0));
-
-        Fraction err;
-        REQUIRE_THROWS_MATCHES(std::istringstream("z1/2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
-        REQUIRE_THROWS_MATCHES(std::istringstream("1z/2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
-        REQUIRE_THROWS_MATCHES(std::istringstream("1/z2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
-        REQUIRE_THROWS_MATCHES(std::istringstream("1/2z") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
-        REQUIRE_THROWS_MATCHES(std::istringstream("1|2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
-        REQUIRE_THROWS_MATCHES(std::istringstream("0/0") >> err, std::runtime_error, Message("Error: Divide by zero."));
-    }
-}
+#include "../sources/fraction.hpp"
+#include "../sources/list.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("Fraction")
+{
+    SECTION("basics")
+    {
+        // Fraction(int numerator = 0, int denominator = 1)
+        Fraction f1;
+        REQUIRE(f1.numerator() == 0);
+        REQUIRE(f1.denominator() == 1);
+        Fraction f2(2);
+        REQUIRE(f2.numerator() == 2);
+        REQUIRE(f2.denominator() == 1);
+        Fraction f3(2, 3);
+        REQUIRE(f3.numerator() == 2);
+        REQUIRE(f3.denominator() == 3);
+        Fraction f4(0, 9);
+        REQUIRE(f4.numerator() == 0);
+        REQUIRE(f4.denominator() == 1);
+        REQUIRE_THROWS_MATCHES(Fraction(1, 0), std::runtime_error, Message("Error: Divide by zero."));
+
+        // Fraction(double number)
+        Fraction f5(0.0);
+        REQUIRE(f5.numerator() == 0);
+        REQUIRE(f5.denominator() == 1);
+        Fraction f6(1.1);
+        REQUIRE(f6.numerator() == 11);
+        REQUIRE(f6.denominator() == 10);
+        Fraction f7(1234.56789);
+        REQUIRE(f7.numerator() == 123456789);
+        REQUIRE(f7.denominator() == 100000);
+        Fraction f8(0.75);
+        REQUIRE(f8.numerator() == 3);
+        REQUIRE(f8.denominator() == 4);
+        Fraction f9(-22.33);
+        REQUIRE(f9.numerator() == -2233);
+        REQUIRE(f9.denominator() == 100);
+        Fraction f10(-1.2);
+        REQUIRE(f10.numerator() == -6);
+        REQUIRE(f10.denominator() == 5);
+        REQUIRE(Fraction(0.1).as_integer_ratio() == std::pair(1, 10));
+        REQUIRE(Fraction(1.0 / 3).as_integer_ratio() == std::pair(1, 3));
+        REQUIRE(Fraction(3.141592653589793).as_integer_ratio() == std::pair(245850922, 78256779));
+        REQUIRE(Fraction(1e9 + 0.5).as_integer_ratio() == std::pair(2000000001, 2));
+        REQUIRE(Fraction(1e-10).as_integer_ratio() == std::pair(0, 1));
+        REQUIRE(Fraction(-5e-324).as_integer_ratio() == std::pair(0, 1));
+        REQUIRE_THROWS_MATCHES(Fraction(1e10), std::runtime_error, Message("Error: The number is too large to convert to fraction."));
+        REQUIRE_THROWS_MATCHES(Fraction(NAN), std::runtime_error, Message("Error: Cannot convert NaN or infinity to fraction."));
+        REQUIRE_THROWS_MATCHES(Fraction(-INFINITY), std::runtime_error, Message("Error: Cannot convert NaN or infinity to fraction."));
+
+        // Fraction(const Fraction& that)
+        Fraction f11(f10);
+        REQUIRE(f11.numerator() == -6);
+        REQUIRE(f11.denominator() == 5);
+
+        // Fraction(Fraction&& that)
+        Fraction f12(std::move(f11));
+        REQUIRE(f12.numerator() == -6);
+        REQUIRE(f12.denominator() == 5);
+
+        // ~Fraction()
+    }
+
+    Fraction zero;
+    Fraction positive(1, 2);
+    Fraction negative(-1, 2);
+
+    SECTION("compare")
+    {
+        REQUIRE(zero == zero);
+        REQUIRE(Fraction(9, 6) == Fraction(3, 2));
+
+        REQUIRE(zero != positive);
+        REQUIRE(positive != negative);
+
+        REQUIRE(zero > negative);
+        REQUIRE(Fraction(1, 2) > Fraction(1, 3));
+
+        REQUIRE(zero < positive);
+        REQUIRE(Fraction(1, 4) < Fraction(1, 3));
+
+        REQUIRE(zero >= zero);
+        REQUIRE(zero >= negative);
+
+        REQUIRE(zero <= zero);
+        REQUIRE(zero <= positive);
+    }
+
+    SECTION("assignment")
+    {
+        positive = negative; // copy
+        REQUIRE(positive == Fraction(-1, 2));
+        REQUIRE(negative == Fraction(-1, 2));
+
+        zero = std::move(negative); // move
+        REQUIRE(zero == Fraction(-1, 2));
+        REQUIRE(negative == Fraction());
+    }
+
+    SECTION("examination")
+    {
+        REQUIRE(double(Fraction(0, 2)) == Approx(0.0));
+        REQUIRE(double(Fraction(1, 2)) == Approx(0.5));
+        REQUIRE(double(Fraction(2, 3)) == Approx(2.0 / 3.0));
+        REQUIRE(double(Fraction(1, -2)) == Approx(-0.5));
+
+        REQUIRE(zero.numerator() == 0);
+        REQUIRE(positive.numerator() == 1);
+        REQUIRE(negative.numerator() == -1);
+
+        REQUIRE(zero.denominator() == 1);
+        REQUIRE(positive.denominator() == 2);
+        REQUIRE(negative.denominator() == 2);
+    }
+
+    SECTION("inc_dec")
+    {
+        // operator++()
+        REQUIRE(++Fraction(-1) == Fraction(0));
+        REQUIRE(++Fraction(0) == Fraction(1));
+        REQUIRE(++Fraction(1) == Fraction(2));
+        REQUIRE(++Fraction(99999) == Fraction(100000));
+
+        // operator--()
+        REQUIRE(--Fraction(-1) == Fraction(-2));
+        REQUIRE(--Fraction(0) == Fraction(-1));
+        REQUIRE(--Fraction(1) == Fraction(0));
+        REQUIRE(--Fraction(100000) == Fraction(99999));
+    }
+
+    SECTION("unary")
+    {
+        REQUIRE(+zero == Fraction(0));
+        REQUIRE(+positive == Fraction(1, 2));
+        REQUIRE(+negative == Fraction(-1, 2));
+
+        REQUIRE(-zero == Fraction(0));
+        REQUIRE(-positive == Fraction(-1, 2));
+        REQUIRE(-negative == Fraction(1, 2));
+
+        REQUIRE(zero.abs() == Fraction(0));
+        REQUIRE(positive.abs() == Fraction(1, 2));
+        REQUIRE(negative.abs() == Fraction(1, 2));
+    }
+
+    SECTION("plus")
+    {
+        REQUIRE(positive + positive == Fraction(1));
+        REQUIRE(positive + zero == Fraction(1, 2));
+        REQUIRE(positive + negative == Fraction(0));
+
+        REQUIRE(negative + positive == Fraction(0));
+        REQUIRE(negative + zero == Fraction(-1, 2));
+        REQUIRE(negative + negative == Fraction(-1));
+
+        REQUIRE(zero + positive == Fraction(1, 2));
+        REQUIRE(zero + zero == Fraction(0));
+        REQUIRE(zero + negative == Fraction(-1, 2));
+    }
+
+    SECTION("minus")
+    {
+        REQUIRE(positive - positive == Fraction(0));
+        REQUIRE(positive - zero == Fraction(1, 2));
+        REQUIRE(positive - negative == Fraction(1));
+
+        REQUIRE(negative - positive == Fraction(-1));
+        REQUIRE(negative - zero == Fraction(-1, 2));
+        REQUIRE(negative - negative == Fraction(0));
+
+        REQUIRE(zero - positive == Fraction(-1, 2));
+        REQUIRE(zero - zero == Fraction(0));
+        REQUIRE(zero - negative == Fraction(1, 2));
+    }
+
+    SECTION("times")
+    {
+        REQUIRE(positive * positive == Fraction(1, 4));
+        REQUIRE(positive * zero == Fraction(0));
+        REQUIRE(positive * negative == Fraction(-1, 4));
+
+        REQUIRE(negative * positive == Fraction(-1, 4));
+        REQUIRE(negative * zero == Fraction(0));
+        REQUIRE(negative * negative == Fraction(1, 4));
+
+        REQUIRE(zero * positive == Fraction(0));
+        REQUIRE(zero * zero == Fraction(0));
+        REQUIRE(zero * negative == Fraction(0));
+    }
+
+    SECTION("divide")
+    {
+        REQUIRE(positive / positive == Fraction(1));
+        REQUIRE_THROWS_MATCHES(positive / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(positive / negative == Fraction(-1));
+
+        REQUIRE(negative / positive == Fraction(-1));
+        REQUIRE_THROWS_MATCHES(negative / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(negative / negative == Fraction(1));
+
+        REQUIRE(zero / positive == Fraction(0));
+        REQUIRE_THROWS_MATCHES(zero / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(zero / negative == Fraction(0));
+    }
+
+    SECTION("mod")
+    {
+        REQUIRE(positive % positive == Fraction(0));
+        REQUIRE_THROWS_MATCHES(positive % zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(positive % negative == Fraction(0));
+
+        REQUIRE(negative % positive == Fraction(0));
+        REQUIRE_THROWS_MATCHES(negative % zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(negative % negative == Fraction(0));
+
+        REQUIRE(zero % positive == Fraction(0));
+        REQUIRE_THROWS_MATCHES(zero % zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(zero % negative == Fraction(0));
+    }
+
+    SECTION("compound")
+    {
+        Fraction f(1, 6);
+        REQUIRE((f += Fraction(1, 3)) == Fraction(1, 2));
+        REQUIRE((f -= Fraction(1, 2)) == Fraction(0));
+        REQUIRE(f.denominator() == 1);
+        REQUIRE((f += Fraction(2, 3)) == Fraction(2, 3));
+        REQUIRE((f *= Fraction(9, 4)) == Fraction(3, 2));
+        REQUIRE((f /= Fraction(-9, 4)) == Fraction(-2, 3));
+        REQUIRE(f.denominator() == 3);
+        REQUIRE_THROWS_MATCHES(f /= zero, std::runtime_error, Message("Error: Divide by zero."));
+
+        // the intermediates stay small, no overflow
+        REQUIRE(Fraction(1, 65536) + Fraction(1, 65536) == Fraction(1, 32768));
+        REQUIRE(Fraction(1 << 30, 3) * Fraction(3, 1 << 30) == Fraction(1));
+        REQUIRE(Fraction(1 << 30, 3) / Fraction(1 << 30, 7) == Fraction(7, 3));
+        REQUIRE(Fraction(INT_MAX, 2) - Fraction(INT_MAX - 2, 2) == Fraction(1));
+    }
+
+    SECTION("gcd_lcm")
+    {
+        // gcd()
+        REQUIRE(Fraction::gcd(Fraction(0), Fraction(0)) == Fraction(0));
+        REQUIRE(Fraction::gcd(Fraction(0), Fraction(1)) == Fraction(1));
+        REQUIRE(Fraction::gcd(Fraction(1), Fraction(0)) == Fraction(1));
+        REQUIRE(Fraction::gcd(Fraction(1), Fraction(1)) == Fraction(1));
+
+        REQUIRE(Fraction::gcd(Fraction(1, 2), Fraction(3, 4)) == Fraction(1, 4));
+        REQUIRE(Fraction::gcd(Fraction(3, 4), Fraction(1, 6)) == Fraction(1, 12));
+        REQUIRE(Fraction::gcd(Fraction(233, 2333), Fraction(7, 77)) == Fraction(1, 25663));
+        REQUIRE(Fraction::gcd(Fraction(-1, 2), Fraction(-3, 4)) == Fraction(1, 4));
+
+        // lcm()
+        REQUIRE(Fraction::lcm(Fraction(0), Fraction(0)) == Fraction(0));
+        REQUIRE(Fraction::lcm(Fraction(0), Fraction(1)) == Fraction(0));
+        REQUIRE(Fraction::lcm(Fraction(1), Fraction(0)) == Fraction(0));
+        REQUIRE(Fraction::lcm(Fraction(1), Fraction(1)) == Fraction(1));
+
+        REQUIRE(Fraction::lcm(Fraction(1, 2), Fraction(3, 4)) == Fraction(3, 2));
+        REQUIRE(Fraction::lcm(Fraction(3, 4), Fraction(1, 6)) == Fraction(3, 2));
+        REQUIRE(Fraction::lcm(Fraction(233, 2333), Fraction(7, 77)) == Fraction(233));
+        REQUIRE(Fraction::lcm(Fraction(-1, 2), Fraction(-3, 4)) == Fraction(3, 2));
+    }
+
+    SECTION("sum")
+    {
+        List<Fraction> list = {Fraction(1, 2), Fraction(1, 3), Fraction(1, 6)};
+        REQUIRE(Fraction::sum(list.begin(), list.end()) == Fraction(1));
+        REQUIRE(Fraction::sum(list.begin(), list.begin()) == zero);
+
+        // harmonic number H(20)
+        std::vector<Fraction> harmonic;
+        for (int i = 1; i <= 20; ++i)
+        {
+            harmonic.push_back(Fraction(1, i));
+        }
+        REQUIRE(Fraction::sum(harmonic.begin(), harmonic.end()).as_integer_ratio() == std::pair(55835135, 15519504));
+
+        // the running denominator overflows long long and moves to Int, the sum fits again
+        std::vector<Fraction> primes;
+        for (int p : {2147483647, 2147483629, 2147483587, 2147483579, 2147483563})
+        {
+            primes.push_back(Fraction(1, p));
+        }
+        for (int p : {2147483563, 2147483579, 2147483587, 2147483629, 2147483647})
+        {
+            primes.push_back(Fraction(-1, p));
+        }
+        primes.push_back(negative);
+        REQUIRE(Fraction::sum(primes.begin(), primes.end()).as_integer_ratio() == std::pair(-1, 2));
+
+        std::vector<Fraction> overflow = {Fraction(1, 2147483647), Fraction(1, 2147483629)};
+        REQUIRE_THROWS_MATCHES(Fraction::sum(overflow.begin(), overflow.end()), std::runtime_error, Message("Error: The result is too large to compute."));
+    }
+
+    SECTION("limit_denominator")
+    {
+        REQUIRE(Fraction(3.141592653589793).limit_denominator(1000).as_integer_ratio() == std::pair(355, 113));
+        REQUIRE(Fraction(-3.141592653589793).limit_denominator(1000).as_integer_ratio() == std::pair(-355, 113));
+        REQUIRE(Fraction(1, 3).limit_denominator(2).as_integer_ratio() == std::pair(1, 2));
+        REQUIRE(Fraction(2, 3).limit_denominator(1).as_integer_ratio() == std::pair(1, 1));
+        REQUIRE(Fraction(3, 2).limit_denominator(1).as_integer_ratio() == std::pair(1, 1)); // ties go to the convergent
+        REQUIRE(Fraction(-1, 2).limit_denominator(1).as_integer_ratio() == std::pair(-1, 1));
+        REQUIRE(Fraction(5, 4).limit_denominator(1).as_integer_ratio() == std::pair(1, 1));
+        REQUIRE(Fraction(7, 3).limit_denominator(3).as_integer_ratio() == std::pair(7, 3));
+        REQUIRE(Fraction(INT_MAX, INT_MAX - 1).limit_denominator(INT_MAX - 2).as_integer_ratio() == std::pair(INT_MAX - 1, INT_MAX - 2));
+        REQUIRE_THROWS_MATCHES(positive.limit_denominator(0), std::runtime_error, Message("Error: Require max_den >= 1 for limit_denominator(max_den)."));
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+
+        oss << zero;
+        REQUIRE(oss.str() == "0");
+        oss.str("");
+
+        oss << positive;
+        REQUIRE(oss.str() == "1/2");
+        oss.str("");
+
+        oss << negative;
+        REQUIRE(oss.str() == "-1/2");
+        oss.str("");
+    }
+
+    SECTION("input")
+    {
+        Fraction f1, f2, f3, f4;
+        std::istringstream("  +1/-2  \n  233 \t 1234/4321  0") >> f1 >> f2 >> f3 >> f4;
+
+        REQUIRE(f1 == Fraction(-1, 2));
+        REQUIRE(f2 == Fraction(233));
+        REQUIRE(f3 == Fraction(1234, 4321));
+        REQUIRE(f4 == Fraction(0));
+
+        Fraction err;
+        REQUIRE_THROWS_MATCHES(std::istringstream("z1/2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("1z/2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("1/z2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("1/2z") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("1|2") >> err, std::runtime_error, Message("Error: Wrong fraction literal."));
+        REQUIRE_THROWS_MATCHES(std::istringstream("0/0") >> err, std::runtime_error, Message("Error: Divide by zero."));
+    }
+}
@@ -1,540 +1,895 @@
-#include "../sources/int.hpp"
-
-#include "tool.hpp"
-
-using namespace pyincpp;
-
-TEST_CASE("Int")
-{
-    SECTION("basics")
-    {
-        // Int(int integer = 0)
-        Int int1;
-        REQUIRE(int1.digits() == 0);
-        REQUIRE(int1.is_zero());
-        Int int2(123456789);
-        REQUIRE(int2.digits() == 9);
-        REQUIRE(!int2.is_zero());
-
-        // Int(const char* chars)
-        Int int3("123456789000");
-        REQUIRE(int3.digits() == 12);
-        REQUIRE(!int3.is_zero());
-        REQUIRE_THROWS_MATCHES(Int("hello"), std::runtime_error, Message("Error: Wrong integer literal."));
-
-        // Int(const Int& that)
-        Int int4(int3);
-        REQUIRE(int4.digits() == 12);
-        REQUIRE(!int4.is_zero());
-
-        // Int(Int&& that)
-        Int int5(std::move(int4));
-        REQUIRE(int5.digits() == 12);
-        REQUIRE(!int5.is_zero());
-        REQUIRE(int4.digits() == 0);
-        REQUIRE(int4.is_zero());
-
-        // ~Int()
-    }
-
-    Int zero;
-    Int positive = "18446744073709551617";  // 2^64+1
-    Int negative = "-18446744073709551617"; // -(2^64+1)
-
-    SECTION("compare")
-    {
-        // operator==
-        REQUIRE(zero == zero);
-        REQUIRE(positive == positive);
-        REQUIRE(negative == negative);
-
-        // operator!=
-        REQUIRE(zero != positive);
-        REQUIRE(zero != negative);
-
-        // operator<
-        REQUIRE(negative < zero);
-        REQUIRE(negative < positive);
-
-        // operator<=
-        REQUIRE(negative <= zero);
-        REQUIRE(negative <= positive);
-        REQUIRE(negative <= negative);
-
-        // operator>
-        REQUIRE(positive > zero);
-        REQUIRE(positive > negative);
-
-        // operator>=
-        REQUIRE(positive >= zero);
-        REQUIRE(positive >= negative);
-        REQUIRE(positive >= positive);
-    }
-
-    SECTION("assignment")
-    {
-        positive = negative; // copy
-        REQUIRE(positive == Int("-18446744073709551617"));
-        REQUIRE(negative == Int("-18446744073709551617"));
-
-        zero = std::move(negative); // move
-        REQUIRE(zero == Int("-18446744073709551617"));
-        REQUIRE(negative == Int());
-    }
-
-    SECTION("examination")
-    {
-        // digits()
-        REQUIRE(zero.digits() == 0);
-        REQUIRE(positive.digits() == 20);
-        REQUIRE(negative.digits() == 20);
-
-        // is_zero()
-        REQUIRE(zero.is_zero());
-        REQUIRE(!positive.is_zero());
-        REQUIRE(!negative.is_zero());
-
-        // is_positive()
-        REQUIRE(!zero.is_positive());
-        REQUIRE(positive.is_positive());
-        REQUIRE(!negative.is_positive());
-
-        // is_negative()
-        REQUIRE(!zero.is_negative());
-        REQUIRE(!positive.is_negative());
-        REQUIRE(negative.is_negative());
-
-        // is_even()
-        REQUIRE(zero.is_even());
-        REQUIRE(!positive.is_even());
-        REQUIRE(!negative.is_even());
-
-        // is_odd()
-        REQUIRE(!zero.is_odd());
-        REQUIRE(positive.is_odd());
-        REQUIRE(negative.is_odd());
-    }
-
-    SECTION("is_prime")
-    {
-        REQUIRE(!Int("-1").is_prime());
-        REQUIRE(!Int("0").is_prime());
-        REQUIRE(!Int("1").is_prime());
-        REQUIRE(Int("2").is_prime());
-        REQUIRE(Int("3").is_prime());
-        REQUIRE(!Int("4").is_prime());
-        REQUIRE(Int("5").is_prime());
-        REQUIRE(!Int("6").is_prime());
-        REQUIRE(Int("7").is_prime());
-        REQUIRE(!Int("8").is_prime());
-        REQUIRE(!Int("9").is_prime());
-        REQUIRE(!Int("10").is_prime());
-
-        REQUIRE(Int("2147483629").is_prime()); // maximum prime number that < INT_MAX
-        REQUIRE(Int("2147483647").is_prime()); // INT_MAX is a prime number
-        REQUIRE(Int("2147483659").is_prime()); // minimum prime number that > INT_MAX
-    }
-
-    SECTION("inc_dec")
-    {
-        // operator++()
-        REQUIRE(++Int("-1") == "0");
-        REQUIRE(++Int("0") == "1");
-        REQUIRE(++Int("1") == "2");
-        REQUIRE(++Int("99999999999999") == "100000000000000");
-
-        // operator--()
-        REQUIRE(--Int("-1") == "-2");
-        REQUIRE(--Int("0") == "-1");
-        REQUIRE(--Int("1") == "0");
-        REQUIRE(--Int("100000000000000") == "99999999999999");
-    }
-
-    SECTION("plus")
-    {
-        REQUIRE(positive + positive == "36893488147419103234");
-        REQUIRE(positive + zero == "18446744073709551617");
-        REQUIRE(positive + negative == "0");
-
-        REQUIRE(negative + positive == "0");
-        REQUIRE(negative + zero == "-18446744073709551617");
-        REQUIRE(negative + negative == "-36893488147419103234");
-
-        REQUIRE(zero + positive == "18446744073709551617");
-        REQUIRE(zero + zero == "0");
-        REQUIRE(zero + negative == "-18446744073709551617");
-
-        REQUIRE(Int("999999999") + Int("1") == "1000000000");
-    }
-
-    SECTION("minus")
-    {
-        REQUIRE(positive - positive == "0");
-        REQUIRE(positive - zero == "18446744073709551617");
-        REQUIRE(positive - negative == "36893488147419103234");
-
-        REQUIRE(negative - positive == "-36893488147419103234");
-        REQUIRE(negative - zero == "-18446744073709551617");
-        REQUIRE(negative - negative == "0");
-
-        REQUIRE(zero - positive == "-18446744073709551617");
-        REQUIRE(zero - zero == "0");
-        REQUIRE(zero - negative == "18446744073709551617");
-
-        REQUIRE(Int("1000000000") - Int("1") == "999999999");
-    }
-
-    SECTION("times")
-    {
-        REQUIRE(positive * positive == "340282366920938463500268095579187314689");
-        REQUIRE(positive * zero == "0");
-        REQUIRE(positive * negative == "-340282366920938463500268095579187314689");
-
-        REQUIRE(negative * positive == "-340282366920938463500268095579187314689");
-        REQUIRE(negative * zero == "0");
-        REQUIRE(negative * negative == "340282366920938463500268095579187314689");
-
-        REQUIRE(zero * positive == "0");
-        REQUIRE(zero * zero == "0");
-        REQUIRE(zero * negative == "0");
-
-        REQUIRE(Int("1000000000") * Int("1") == "1000000000");
-        REQUIRE(Int("999999999") * Int("999999999") * Int("999999999") == "999999997000000002999999999");
-    }
-
-    SECTION("divide")
-    {
-        REQUIRE(positive / positive == "1");
-        REQUIRE_THROWS_MATCHES(positive / zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(positive / negative == "-1");
-
-        REQUIRE(negative / positive == "-1");
-        REQUIRE_THROWS_MATCHES(negative / zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(negative / negative == "1");
-
-        REQUIRE(zero / positive == "0");
-        REQUIRE_THROWS_MATCHES(zero / zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(zero / negative == "0");
-
-        REQUIRE(Int("1000000000") / Int("1") == "1000000000");
-    }
-
-    SECTION("mod")
-    {
-        REQUIRE(positive % positive == "0");
-        REQUIRE_THROWS_MATCHES(positive % zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(positive % negative == "0");
-
-        REQUIRE(negative % positive == "0");
-        REQUIRE_THROWS_MATCHES(negative % zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(negative % negative == "0");
-
-        REQUIRE(zero % positive == "0");
-        REQUIRE_THROWS_MATCHES(zero % zero, std::runtime_error, Message("Error: Divide by zero."));
-        REQUIRE(zero % negative == "0");
-
-        REQUIRE(Int("1000000000") % Int("1") == "0");
-    }
-
-    SECTION("divmod")
-    {
-        REQUIRE(Int(-5).divmod(-2) == std::pair{2, -1});
-        REQUIRE(Int(-5).divmod(2) == std::pair{-2, -1});
-        REQUIRE(Int(5).divmod(-2) == std::pair{-2, 1});
-        REQUIRE(Int(5).divmod(2) == std::pair{2, 1});
-
-        REQUIRE(Int(12345).divmod(54321) == std::pair{0, 12345});
-        REQUIRE(Int(54321).divmod(12345) == std::pair{4, 4941});
-        REQUIRE(Int(987654321).divmod(123456789) == std::pair{8, 9});
-        REQUIRE(Int(123456789).divmod(987654321) == std::pair{0, 123456789});
-
-        REQUIRE(positive.divmod(100) == std::pair{"184467440737095516", 17});
-        REQUIRE(negative.divmod(100) == std::pair{"-184467440737095516", -17});
-        REQUIRE(zero.divmod(100) == std::pair{0, 0});
-
-        for (Int a = -100; a < 100; ++a)
-        {
-            for (Int b = -100; !b.is_zero() && b < 100; ++b)
-            {
-                auto [q, r] = a.divmod(b);
-                REQUIRE(a == q * b + r);
-            }
-        }
-    }
-
-    SECTION("factorial")
-    {
-        // (negative)! throws exception
-        REQUIRE_THROWS_MATCHES(Int("-1").factorial(), std::runtime_error, Message("Error: Require this >= 0 for factorial()."));
-
-        // 0! == 1
-        REQUIRE(Int("0").factorial() == "1");
-
-        // 1! == 1
-        REQUIRE(Int("1").factorial() == "1");
-
-        // 2! == 2
-        REQUIRE(Int("2").factorial() == "2");
-
-        // 3! == 6
-        REQUIRE(Int("3").factorial() == "6");
-
-        // 100! == 93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000
-        REQUIRE(Int("100").factorial() == "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000");
-
-        // (5!)! == 6689502913449127057588118054090372586752746333138029810295671352301633557244962989366874165271984981308157637893214090552534408589408121859898481114389650005964960521256960000000000000000000000000000
-        REQUIRE(Int("5").factorial().factorial() == "6689502913449127057588118054090372586752746333138029810295671352301633557244962989366874165271984981308157637893214090552534408589408121859898481114389650005964960521256960000000000000000000000000000");
-    }
-
-    SECTION("next_prime")
-    {
-        Int number; // 0
-        int primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71};
-        for (auto&& prime : primes)
-        {
-            number = number.next_prime();
-            REQUIRE(number == prime);
-        }
-
-        REQUIRE(Int(104728).next_prime() == 104729); // the 10000th prime
-
-        REQUIRE(Int("2147483628").next_prime() == "2147483629"); // maximum prime number that < INT_MAX
-        REQUIRE(Int("2147483629").next_prime() == "2147483647"); // INT_MAX is a prime number
-        REQUIRE(Int("2147483647").next_prime() == "2147483659"); // minimum prime number that > INT_MAX
-    }
-
-    SECTION("to_number")
-    {
-        REQUIRE(zero.to_number<signed char>() == 0);
-        REQUIRE(std::is_same_v<decltype(zero.to_number<signed char>()), signed char>);
-
-        REQUIRE(zero.to_number<long long>() == 0);
-        REQUIRE(std::is_same_v<decltype(zero.to_number<long long>()), long long>);
-
-        REQUIRE(Int("2147483647").to_number() == 2147483647);
-        REQUIRE(Int("-2147483647").to_number() == -2147483647);
-
-        REQUIRE(Int("2147483648").to_number<double>() == 2147483648.0);
-        REQUIRE(Int("-2147483648").to_number<double>() == -2147483648.0);
-    }
-
-    SECTION("sqrt")
-    {
-        REQUIRE_THROWS_MATCHES(Int::sqrt("-1"), std::runtime_error, Message("Error: Require n >= 0 for sqrt(n)."));
-
-        REQUIRE(Int::sqrt("0") == "0");
-        REQUIRE(Int::sqrt("1") == "1");
-        REQUIRE(Int::sqrt("2") == "1");
-        REQUIRE(Int::sqrt("3") == "1");
-        REQUIRE(Int::sqrt("4") == "2");
-        REQUIRE(Int::sqrt("5") == "2");
-        REQUIRE(Int::sqrt("9") == "3");
-        REQUIRE(Int::sqrt("10") == "3");
-        REQUIRE(Int::sqrt("16") == "4");
-        REQUIRE(Int::sqrt("100") == "10");
-        REQUIRE(Int::sqrt("9801") == "99");
-        REQUIRE(Int::sqrt("998001") == "999");
-        REQUIRE(Int::sqrt("99980001") == "9999");
-        REQUIRE(Int::sqrt("9999800001") == "99999");
-    }
-
-    SECTION("pow")
-    {
-        // special situations
-        REQUIRE(Int::pow("-1", "-1") == "-1");
-        REQUIRE(Int::pow("-1", "0") == "1");
-        REQUIRE(Int::pow("-1", "1") == "-1");
-        REQUIRE_THROWS_MATCHES(Int::pow("0", "-1"), std::runtime_error, Message("Error: Math domain error."));
-        REQUIRE(Int::pow("0", "0") == "1");
-        REQUIRE(Int::pow("0", "1") == "0");
-        REQUIRE(Int::pow("1", "-1") == "1");
-        REQUIRE(Int::pow("1", "0") == "1");
-        REQUIRE(Int::pow("1", "1") == "1");
-
-        // 2^3 == 8
-        REQUIRE(Int::pow("2", "3") == "8");
-
-        // 2^100 == 1267650600228229401496703205376
-        REQUIRE(Int::pow("2", "100") == "1267650600228229401496703205376");
-
-        // (9^9)^9 == 196627050475552913618075908526912116283103450944214766927315415537966391196809
-        REQUIRE(Int::pow(Int::pow("9", "9"), "9") == "196627050475552913618075908526912116283103450944214766927315415537966391196809");
-
-        // 1024^1024 % 100 == 76
-        REQUIRE(Int::pow("1024", "1024", "100") == "76");
-
-        // 9999^1001 % 100 == 99
-        REQUIRE(Int::pow("9999", "1001", "100") == "99");
-    }
-
-    SECTION("log")
-    {
-        REQUIRE_THROWS_MATCHES(Int::log(negative, 2), std::runtime_error, Message("Error: Math domain error."));
-        REQUIRE_THROWS_MATCHES(Int::log(zero, 2), std::runtime_error, Message("Error: Math domain error."));
-        REQUIRE_THROWS_MATCHES(Int::log(positive, 1), std::runtime_error, Message("Error: Math domain error."));
-
-        REQUIRE(Int::log(1, 2) == 0);
-        REQUIRE(Int::log(1, 3) == 0);
-        REQUIRE(Int::log(1, 4) == 0);
-
-        REQUIRE(Int::log(2, 2) == 1);
-        REQUIRE(Int::log(4, 2) == 2);
-        REQUIRE(Int::log(8, 2) == 3);
-
-        REQUIRE(Int::log(10, 10) == 1);
-        REQUIRE(Int::log(100, 10) == 2);
-        REQUIRE(Int::log(1000, 10) == 3);
-
-        REQUIRE(Int::log(123, 10) == 2);
-        REQUIRE(Int::log(12345, 10) == 4);
-        REQUIRE(Int::log(123456789, 10) == 8);
-
-        REQUIRE(Int::log(positive, 2) == 64);         // integer: 2^64+1
-        REQUIRE(Int::log(positive * 2 - 3, 2) == 64); // integer: 2^65-1
-        REQUIRE(Int::log(positive * 2 - 2, 2) == 65); // integer: 2^65
-        REQUIRE(Int::log(positive * 2, 2) == 65);     // integer: 2^65+2
-
-        REQUIRE(Int::log("123456789000", 233) == 4); // 4.6851911360933745
-    }
-
-    SECTION("gcd_lcm")
-    {
-        // gcd()
-        REQUIRE(Int::gcd("0", "0") == "0");
-        REQUIRE(Int::gcd("0", "1") == "1");
-        REQUIRE(Int::gcd("1", "0") == "1");
-        REQUIRE(Int::gcd("1", "1") == "1");
-
-        REQUIRE(Int::gcd("6", "8") == "2");
-        REQUIRE(Int::gcd("24", "48") == "24");
-        REQUIRE(Int::gcd("37", "48") == "1");
-        REQUIRE(Int::gcd("12345", "54321") == "3");
-
-        // lcm()
-        REQUIRE(Int::lcm("0", "0") == "0");
-        REQUIRE(Int::lcm("0", "1") == "0");
-        REQUIRE(Int::lcm("1", "0") == "0");
-        REQUIRE(Int::lcm("1", "1") == "1");
-
-        REQUIRE(Int::lcm("6", "8") == "24");
-        REQUIRE(Int::lcm("24", "48") == "48");
-        REQUIRE(Int::lcm("37", "48") == "1776");
-        REQUIRE(Int::lcm("12345", "54321") == "223530915");
-    }
-
-    SECTION("random")
-    {
-        // static Int random(const Int& a, const Int& b)
-        REQUIRE_THROWS_MATCHES(Int::random(2, 1), std::runtime_error, Message("Error: Require a >= b for random(a, b)."));
-
-        for (int i = 1; i < 10; i++)
-        {
-            REQUIRE(Int::random(1, i).digits() == 1);
-        }
-
-        REQUIRE(Int::random("9999999999999999999999", "9999999999999999999999").digits() == 22);
-
-        Int sum = 0;
-        for (int i = 0; i < 1000; i++) // sum should ~= 0.5 * 1000 = 500
-        {
-            sum += Int::random(0, 1); // mean = 0.5
-        }
-        REQUIRE((int(500 * 0.9) < sum && sum < int(500 * 1.1)));
-
-        // static Int random(int digits)
-        REQUIRE_THROWS_MATCHES(Int::random(0), std::runtime_error, Message("Error: Require digits > 0 for random(digits)."));
-
-        for (int d = 1; d < 10; d++)
-        {
-            REQUIRE(Int::random(d).digits() == d);
-        }
-
-        REQUIRE(Int::random(1024).digits() == 1024);
-
-        sum = 0;
-        for (int i = 0; i < 1000; i++) // sum should ~= 5 * 1000 = 5000
-        {
-            sum += Int::random(1); // mean = 5
-        }
-        REQUIRE((int(5000 * 0.9) < sum && sum < int(5000 * 1.1)));
-    }
-
-    SECTION("fibonacci")
-    {
-        int fib[] = {0, 1, 1, 2, 3, 5, 8, 13, 21, 34};
-
-        for (int i = 0; i < 10; ++i)
-        {
-            REQUIRE(Int::fibonacci(i) == fib[i]);
-        }
-
-        REQUIRE(Int::fibonacci(100) == "354224848179261915075");
-    }
-
-    SECTION("ackermann")
-    {
-        // https://en.wikipedia.org/wiki/Ackermann_function#Table_of_values
-        int A[4][10] = {
-            {1, 2, 3, 4, 5, 6, 7, 8, 9, 10},                 // m=0, inc
-            {2, 3, 4, 5, 6, 7, 8, 9, 10, 11},                // m=1, add
-            {3, 5, 7, 9, 11, 13, 15, 17, 19, 21},            // m=2, mul
-            {5, 13, 29, 61, 125, 253, 509, 1021, 2045, 4093} // m=3, pow
-        };
-
-        for (int m = 0; m < 4; m++)
-        {
-            for (int n = 0; n < 10; n++)
-            {
-                REQUIRE(Int::ackermann(m, n) == A[m][n]);
-            }
-        }
-
-        // m=4, tetration
-        REQUIRE(Int::ackermann(4, 0) == 13);             // 2^^3 - 3 = 2^4 - 3     = 13
-        REQUIRE(Int::ackermann(4, 1) == 65533);          // 2^^4 - 3 = 2^16 - 3    = 65533
-        REQUIRE(Int::ackermann(4, 2).digits() == 19729); // 2^^5 - 3 = 2^65536 - 3 = 2003529930406...(19729 digits)
-        // A(4, 3) = 2^^6 - 3 = 2^2^65536 - 3, there is no computer can compute it...
-    }
-
-    SECTION("hyperoperation")
-    {
-        REQUIRE_THROWS_MATCHES(Int::hyperoperation(-1, -1, -1), std::runtime_error, Message("Error: Require n >= 0 and a >= 0 and b >= 0 for hyperoperation(n, a, b)."));
-
-        REQUIRE(Int::hyperoperation(0, 0, 0) == 1);
-        REQUIRE(Int::hyperoperation(1000, 2, 2) == 4);
-
-        REQUIRE(Int::hyperoperation(0, 3, 3) == 4);               // successor
-        REQUIRE(Int::hyperoperation(1, 3, 3) == 6);               // addition
-        REQUIRE(Int::hyperoperation(2, 3, 3) == 9);               // multiplication
-        REQUIRE(Int::hyperoperation(3, 3, 3) == 27);              // exponentiation
-        REQUIRE(Int::hyperoperation(4, 3, 3) == 7625597484987LL); // tetration
-    }
-
-    SECTION("print")
-    {
-        std::ostringstream oss;
-
-        oss << zero;
-        REQUIRE(oss.str() == "0");
-        oss.str("");
-
-        oss << positive;
-        REQUIRE(oss.str() == "18446744073709551617");
-        oss.str("");
-
-        oss << negative;
-        REQUIRE(oss.str() == "-18446744073709551617");
-        oss.str("");
-    }
-
-    SECTION("input")
-    {
-        Int int1, int2, int3, int4;
-        std::istringstream("+123\n-456\t789 0") >> int1 >> int2 >> int3 >> int4;
-
-        REQUIRE(int1 == Int("123"));
-        REQUIRE(int2 == Int("-456"));
-        REQUIRE(int3 == Int("789"));
-        REQUIRE(int4 == Int("0"));
-    }
-}
+#include "../sources/int.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("Int")
+{
+    SECTION("basics")
+    {
+        // Int(int integer = 0)
+        Int int1;
+        REQUIRE(int1.digits() == 0);
+        REQUIRE(int1.is_zero());
+        Int int2(123456789);
+        REQUIRE(int2.digits() == 9);
+        REQUIRE(!int2.is_zero());
+
+        // Int(const char* chars)
+        Int int3("123456789000");
+        REQUIRE(int3.digits() == 12);
+        REQUIRE(!int3.is_zero());
+        REQUIRE_THROWS_MATCHES(Int("hello"), std::runtime_error, Message("Error: Wrong integer literal."));
+
+        // Int(const Int& that)
+        Int int4(int3);
+        REQUIRE(int4.digits() == 12);
+        REQUIRE(!int4.is_zero());
+
+        // Int(Int&& that)
+        Int int5(std::move(int4));
+        REQUIRE(int5.digits() == 12);
+        REQUIRE(!int5.is_zero());
+        REQUIRE(int4.digits() == 0);
+        REQUIRE(int4.is_zero());
+
+        // ~Int()
+    }
+
+    Int zero;
+    Int positive = "18446744073709551617";  // 2^64+1
+    Int negative = "-18446744073709551617"; // -(2^64+1)
+
+    SECTION("compare")
+    {
+        // operator==
+        REQUIRE(zero == zero);
+        REQUIRE(positive == positive);
+        REQUIRE(negative == negative);
+
+        // operator!=
+        REQUIRE(zero != positive);
+        REQUIRE(zero != negative);
+
+        // operator<
+        REQUIRE(negative < zero);
+        REQUIRE(negative < positive);
+
+        // operator<=
+        REQUIRE(negative <= zero);
+        REQUIRE(negative <= positive);
+        REQUIRE(negative <= negative);
+
+        // operator>
+        REQUIRE(positive > zero);
+        REQUIRE(positive > negative);
+
+        // operator>=
+        REQUIRE(positive >= zero);
+        REQUIRE(positive >= negative);
+        REQUIRE(positive >= positive);
+    }
+
+    SECTION("assignment")
+    {
+        positive = negative; // copy
+        REQUIRE(positive == Int("-18446744073709551617"));
+        REQUIRE(negative == Int("-18446744073709551617"));
+
+        zero = std::move(negative); // move
+        REQUIRE(zero == Int("-18446744073709551617"));
+        REQUIRE(negative == Int());
+    }
+
+    SECTION("examination")
+    {
+        // digits()
+        REQUIRE(zero.digits() == 0);
+        REQUIRE(positive.digits() == 20);
+        REQUIRE(negative.digits() == 20);
+
+        // is_zero()
+        REQUIRE(zero.is_zero());
+        REQUIRE(!positive.is_zero());
+        REQUIRE(!negative.is_zero());
+
+        // is_positive()
+        REQUIRE(!zero.is_positive());
+        REQUIRE(positive.is_positive());
+        REQUIRE(!negative.is_positive());
+
+        // is_negative()
+        REQUIRE(!zero.is_negative());
+        REQUIRE(!positive.is_negative());
+        REQUIRE(negative.is_negative());
+
+        // is_even()
+        REQUIRE(zero.is_even());
+        REQUIRE(!positive.is_even());
+        REQUIRE(!negative.is_even());
+
+        // is_odd()
+        REQUIRE(!zero.is_odd());
+        REQUIRE(positive.is_odd());
+        REQUIRE(negative.is_odd());
+    }
+
+    SECTION("is_prime")
+    {
+        REQUIRE(!Int("-1").is_prime());
+        REQUIRE(!Int("0").is_prime());
+        REQUIRE(!Int("1").is_prime());
+        REQUIRE(Int("2").is_prime());
+        REQUIRE(Int("3").is_prime());
+        REQUIRE(!Int("4").is_prime());
+        REQUIRE(Int("5").is_prime());
+        REQUIRE(!Int("6").is_prime());
+        REQUIRE(Int("7").is_prime());
+        REQUIRE(!Int("8").is_prime());
+        REQUIRE(!Int("9").is_prime());
+        REQUIRE(!Int("10").is_prime());
+
+        REQUIRE(Int("2147483629").is_prime()); // maximum prime number that < INT_MAX
+        REQUIRE(Int("2147483647").is_prime()); // INT_MAX is a prime number
+        REQUIRE(Int("2147483659").is_prime()); // minimum prime number that > INT_MAX
+    }
+
+    SECTION("inc_dec")
+    {
+        // operator++()
+        REQUIRE(++Int("-1") == "0");
+        REQUIRE(++Int("0") == "1");
+        REQUIRE(++Int("1") == "2");
+        REQUIRE(++Int("99999999999999") == "100000000000000");
+
+        // operator--()
+        REQUIRE(--Int("-1") == "-2");
+        REQUIRE(--Int("0") == "-1");
+        REQUIRE(--Int("1") == "0");
+        REQUIRE(--Int("100000000000000") == "99999999999999");
+    }
+
+    SECTION("plus")
+    {
+        REQUIRE(positive + positive == "36893488147419103234");
+        REQUIRE(positive + zero == "18446744073709551617");
+        REQUIRE(positive + negative == "0");
+
+        REQUIRE(negative + positive == "0");
+        REQUIRE(negative + zero == "-18446744073709551617");
+        REQUIRE(negative + negative == "-36893488147419103234");
+
+        REQUIRE(zero + positive == "18446744073709551617");
+        REQUIRE(zero + zero == "0");
+        REQUIRE(zero + negative == "-18446744073709551617");
+
+        REQUIRE(Int("999999999") + Int("1") == "1000000000");
+        REQUIRE(Int("999999999999999999999999999") + Int("1") == "1000000000000000000000000000");
+        REQUIRE(Int("1") + Int("999999999999999999999999999") == "1000000000000000000000000000");
+        REQUIRE(Int("999999999999999999") + Int("999999999999999999") == "1999999999999999998");
+    }
+
+    SECTION("minus")
+    {
+        REQUIRE(positive - positive == "0");
+        REQUIRE(positive - zero == "18446744073709551617");
+        REQUIRE(positive - negative == "36893488147419103234");
+
+        REQUIRE(negative - positive == "-36893488147419103234");
+        REQUIRE(negative - zero == "-18446744073709551617");
+        REQUIRE(negative - negative == "0");
+
+        REQUIRE(zero - positive == "-18446744073709551617");
+        REQUIRE(zero - zero == "0");
+        REQUIRE(zero - negative == "18446744073709551617");
+
+        REQUIRE(Int("1000000000") - Int("1") == "999999999");
+        REQUIRE(Int("1000000000000000000000000000") - Int("1") == "999999999999999999999999999");
+        REQUIRE(Int("1") - Int("1000000000000000000000000000") == "-999999999999999999999999999");
+        REQUIRE(Int("1000000000000000000") - Int("999999999999999999") == "1");
+
+        for (int i = 1; i < 100; ++i)
+        {
+            Int a = Int::random(i * 10), b = Int::random(i * 7);
+            REQUIRE(a + b - b == a);
+            REQUIRE(b - a + a == b);
+        }
+    }
+
+    SECTION("times")
+    {
+        REQUIRE(positive * positive == "340282366920938463500268095579187314689");
+        REQUIRE(positive * zero == "0");
+        REQUIRE(positive * negative == "-340282366920938463500268095579187314689");
+
+        REQUIRE(negative * positive == "-340282366920938463500268095579187314689");
+        REQUIRE(negative * zero == "0");
+        REQUIRE(negative * negative == "340282366920938463500268095579187314689");
+
+        REQUIRE(zero * positive == "0");
+        REQUIRE(zero * zero == "0");
+        REQUIRE(zero * negative == "0");
+
+        REQUIRE(Int("1000000000") * Int("1") == "1000000000");
+        REQUIRE(Int("999999999") * Int("999999999") * Int("999999999") == "999999997000000002999999999");
+
+        // Karatsuba multiplication, balanced and unbalanced
+        for (int d : {300, 1000, 5000})
+        {
+            Int a = Int::random(d), b = Int::random(d / 3), c = Int::random(d * 2);
+            REQUIRE(a * b == b * a);
+            REQUIRE((a + c) * (a + c) == a * a + a * c * 2 + c * c);
+            REQUIRE((a - b) * (a + b) == a * a - b * b);
+        }
+        REQUIRE(Int::pow(10, 999) * Int::pow(10, 1000) == Int::pow(10, 1999));
+        REQUIRE((Int::pow(10, 999) - 1) * (Int::pow(10, 1000) - 1) == Int::pow(10, 1999) - Int::pow(10, 999) - Int::pow(10, 1000) + 1);
+
+        // parallel multiplication
+        REQUIRE_THROWS_MATCHES(Int::set_threads(0), std::runtime_error, Message("Error: Require threads >= 1 for set_threads(threads)."));
+        Int a = Int::random(30000), b = Int::random(20000);
+        Int serial = a * b;
+        Int::set_threads(4);
+        REQUIRE(a * b == serial);
+        Int::set_threads(2);
+        REQUIRE(a * b == serial);
+        Int::set_threads(1);
+    }
+
+    SECTION("divide")
+    {
+        REQUIRE(positive / positive == "1");
+        REQUIRE_THROWS_MATCHES(positive / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(positive / negative == "-1");
+
+        REQUIRE(negative / positive == "-1");
+        REQUIRE_THROWS_MATCHES(negative / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(negative / negative == "1");
+
+        REQUIRE(zero / positive == "0");
+        REQUIRE_THROWS_MATCHES(zero / zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(zero / negative == "0");
+
+        REQUIRE(Int("1000000000") / Int("1") == "1000000000");
+    }
+
+    SECTION("mod")
+    {
+        REQUIRE(positive % positive == "0");
+        REQUIRE_THROWS_MATCHES(positive % zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(positive % negative == "0");
+
+        REQUIRE(negative % positive == "0");
+        REQUIRE_THROWS_MATCHES(negative % zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(negative % negative == "0");
+
+        REQUIRE(zero % positive == "0");
+        REQUIRE_THROWS_MATCHES(zero % zero, std::runtime_error, Message("Error: Divide by zero."));
+        REQUIRE(zero % negative == "0");
+
+        REQUIRE(Int("1000000000") % Int("1") == "0");
+    }
+
+    SECTION("divmod")
+    {
+        REQUIRE(Int(-5).divmod(-2) == std::pair{2, -1});
+        REQUIRE(Int(-5).divmod(2) == std::pair{-2, -1});
+        REQUIRE(Int(5).divmod(-2) == std::pair{-2, 1});
+        REQUIRE(Int(5).divmod(2) == std::pair{2, 1});
+
+        REQUIRE(Int(12345).divmod(54321) == std::pair{0, 12345});
+        REQUIRE(Int(54321).divmod(12345) == std::pair{4, 4941});
+        REQUIRE(Int(987654321).divmod(123456789) == std::pair{8, 9});
+        REQUIRE(Int(123456789).divmod(987654321) == std::pair{0, 123456789});
+
+        REQUIRE(positive.divmod(100) == std::pair{"184467440737095516", 17});
+        REQUIRE(negative.divmod(100) == std::pair{"-184467440737095516", -17});
+        REQUIRE(zero.divmod(100) == std::pair{0, 0});
+
+        for (Int a = -100; a < 100; ++a)
+        {
+            for (Int b = -100; !b.is_zero() && b < 100; ++b)
+            {
+                auto [q, r] = a.divmod(b);
+                REQUIRE(a == q * b + r);
+            }
+        }
+
+        // long division
+        REQUIRE(Int("1000000000000000000000000000").divmod("999999999999999999") == std::pair{"1000000000", "1000000000"});
+        REQUIRE(Int("-340282366920938463500268095579187314689").divmod(positive) == std::pair{"-18446744073709551617", 0});
+        for (int i = 1; i < 50; ++i)
+        {
+            Int a = Int::random(i * 40), b = Int::random(i * 13 + 10);
+            auto [q, r] = a.divmod(b);
+            REQUIRE(a == q * b + r);
+            REQUIRE((!r.is_negative() && r < b));
+            REQUIRE(-a == -q * b - r);
+        }
+    }
+
+    SECTION("factorial")
+    {
+        // (negative)! throws exception
+        REQUIRE_THROWS_MATCHES(Int("-1").factorial(), std::runtime_error, Message("Error: Require this >= 0 for factorial()."));
+
+        // 0! == 1
+        REQUIRE(Int("0").factorial() == "1");
+
+        // 1! == 1
+        REQUIRE(Int("1").factorial() == "1");
+
+        // 2! == 2
+        REQUIRE(Int("2").factorial() == "2");
+
+        // 3! == 6
+        REQUIRE(Int("3").factorial() == "6");
+
+        // 100! == 93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000
+        REQUIRE(Int("100").factorial() == "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000");
+
+        // (5!)! == 6689502913449127057588118054090372586752746333138029810295671352301633557244962989366874165271984981308157637893214090552534408589408121859898481114389650005964960521256960000000000000000000000000000
+        REQUIRE(Int("5").factorial().factorial() == "6689502913449127057588118054090372586752746333138029810295671352301633557244962989366874165271984981308157637893214090552534408589408121859898481114389650005964960521256960000000000000000000000000000");
+    }
+
+    SECTION("next_prime")
+    {
+        Int number; // 0
+        int primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71};
+        for (auto&& prime : primes)
+        {
+            number = number.next_prime();
+            REQUIRE(number == prime);
+        }
+
+        REQUIRE(Int(104728).next_prime() == 104729); // the 10000th prime
+
+        REQUIRE(Int("2147483628").next_prime() == "2147483629"); // maximum prime number that < INT_MAX
+        REQUIRE(Int("2147483629").next_prime() == "2147483647"); // INT_MAX is a prime number
+        REQUIRE(Int("2147483647").next_prime() == "2147483659"); // minimum prime number that > INT_MAX
+    }
+
+    SECTION("factorize")
+    {
+        REQUIRE(Int(1).factorize() == List<Int>());
+        REQUIRE(Int(-360).factorize() == List<Int>({2, 2, 2, 3, 3, 5}));
+        REQUIRE(Int(3215031751).factorize() == List<Int>({151, 751, 28351}));
+        REQUIRE(Int("1000006000009").factorize() == List<Int>({1000003, 1000003}));
+        REQUIRE(Int("1000000016000000063").factorize() == List<Int>({1000000007, 1000000009}));
+        REQUIRE((Int::pow(2, 64) + 1).factorize() == List<Int>({274177, "67280421310721"}));                       // Pollard-Brent rho
+        REQUIRE((Int::pow(2, 128) + 1).factorize() == List<Int>({"59649589127497217", "5704689200685129054721"})); // ECM
+        REQUIRE((Int::pow(2, 127) - 1).factorize() == List<Int>({Int::pow(2, 127) - 1}));
+
+        Int product = 1;
+        for (const Int& factor : Int(100).factorial().factorize())
+        {
+            product *= factor;
+        }
+        REQUIRE(product == Int(100).factorial());
+
+        REQUIRE_THROWS_MATCHES(zero.factorize(), std::runtime_error, Message("Error: Require this != 0 for factorize()."));
+    }
+
+    SECTION("to_number")
+    {
+        REQUIRE(zero.to_number<signed char>() == 0);
+        REQUIRE(std::is_same_v<decltype(zero.to_number<signed char>()), signed char>);
+
+        REQUIRE(zero.to_number<long long>() == 0);
+        REQUIRE(std::is_same_v<decltype(zero.to_number<long long>()), long long>);
+
+        REQUIRE(Int("2147483647").to_number() == 2147483647);
+        REQUIRE(Int("-2147483647").to_number() == -2147483647);
+
+        REQUIRE(Int("2147483648").to_number<double>() == 2147483648.0);
+        REQUIRE(Int("-2147483648").to_number<double>() == -2147483648.0);
+    }
+
+    SECTION("sqrt")
+    {
+        REQUIRE_THROWS_MATCHES(Int::sqrt("-1"), std::runtime_error, Message("Error: Require n >= 0 for sqrt(n)."));
+
+        REQUIRE(Int::sqrt("0") == "0");
+        REQUIRE(Int::sqrt("1") == "1");
+        REQUIRE(Int::sqrt("2") == "1");
+        REQUIRE(Int::sqrt("3") == "1");
+        REQUIRE(Int::sqrt("4") == "2");
+        REQUIRE(Int::sqrt("5") == "2");
+        REQUIRE(Int::sqrt("9") == "3");
+        REQUIRE(Int::sqrt("10") == "3");
+        REQUIRE(Int::sqrt("16") == "4");
+        REQUIRE(Int::sqrt("100") == "10");
+        REQUIRE(Int::sqrt("9801") == "99");
+        REQUIRE(Int::sqrt("998001") == "999");
+        REQUIRE(Int::sqrt("99980001") == "9999");
+        REQUIRE(Int::sqrt("9999800001") == "99999");
+    }
+
+    SECTION("pow")
+    {
+        // special situations
+        REQUIRE(Int::pow("-1", "-1") == "-1");
+        REQUIRE(Int::pow("-1", "0") == "1");
+        REQUIRE(Int::pow("-1", "1") == "-1");
+        REQUIRE_THROWS_MATCHES(Int::pow("0", "-1"), std::runtime_error, Message("Error: Math domain error."));
+        REQUIRE(Int::pow("0", "0") == "1");
+        REQUIRE(Int::pow("0", "1") == "0");
+        REQUIRE(Int::pow("1", "-1") == "1");
+        REQUIRE(Int::pow("1", "0") == "1");
+        REQUIRE(Int::pow("1", "1") == "1");
+
+        // 2^3 == 8
+        REQUIRE(Int::pow("2", "3") == "8");
+
+        // 2^100 == 1267650600228229401496703205376
+        REQUIRE(Int::pow("2", "100") == "1267650600228229401496703205376");
+
+        // (9^9)^9 == 196627050475552913618075908526912116283103450944214766927315415537966391196809
+        REQUIRE(Int::pow(Int::pow("9", "9"), "9") == "196627050475552913618075908526912116283103450944214766927315415537966391196809");
+
+        // 1024^1024 % 100 == 76
+        REQUIRE(Int::pow("1024", "1024", "100") == "76");
+
+        // 9999^1001 % 100 == 99
+        REQUIRE(Int::pow("9999", "1001", "100") == "99");
+    }
+
+    SECTION("log")
+    {
+        REQUIRE_THROWS_MATCHES(Int::log(negative, 2), std::runtime_error, Message("Error: Math domain error."));
+        REQUIRE_THROWS_MATCHES(Int::log(zero, 2), std::runtime_error, Message("Error: Math domain error."));
+        REQUIRE_THROWS_MATCHES(Int::log(positive, 1), std::runtime_error, Message("Error: Math domain error."));
+
+        REQUIRE(Int::log(1, 2) == 0);
+        REQUIRE(Int::log(1, 3) == 0);
+        REQUIRE(Int::log(1, 4) == 0);
+
+        REQUIRE(Int::log(2, 2) == 1);
+        REQUIRE(Int::log(4, 2) == 2);
+        REQUIRE(Int::log(8, 2) == 3);
+
+        REQUIRE(Int::log(10, 10) == 1);
+        REQUIRE(Int::log(100, 10) == 2);
+        REQUIRE(Int::log(1000, 10) == 3);
+
+        REQUIRE(Int::log(123, 10) == 2);
+        REQUIRE(Int::log(12345, 10) == 4);
+        REQUIRE(Int::log(123456789, 10) == 8);
+
+        REQUIRE(Int::log(positive, 2) == 64);         // integer: 2^64+1
+        REQUIRE(Int::log(positive * 2 - 3, 2) == 64); // integer: 2^65-1
+        REQUIRE(Int::log(positive * 2 - 2, 2) == 65); // integer: 2^65
+        REQUIRE(Int::log(positive * 2, 2) == 65);     // integer: 2^65+2
+
+        REQUIRE(Int::log("123456789000", 233) == 4); // 4.6851911360933745
+    }
+
+    SECTION("gcd_lcm")
+    {
+        // gcd()
+        REQUIRE(Int::gcd("0", "0") == "0");
+        REQUIRE(Int::gcd("0", "1") == "1");
+        REQUIRE(Int::gcd("1", "0") == "1");
+        REQUIRE(Int::gcd("1", "1") == "1");
+
+        REQUIRE(Int::gcd("6", "8") == "2");
+        REQUIRE(Int::gcd("24", "48") == "24");
+        REQUIRE(Int::gcd("37", "48") == "1");
+        REQUIRE(Int::gcd("12345", "54321") == "3");
+
+        // lcm()
+        REQUIRE(Int::lcm("0", "0") == "0");
+        REQUIRE(Int::lcm("0", "1") == "0");
+        REQUIRE(Int::lcm("1", "0") == "0");
+        REQUIRE(Int::lcm("1", "1") == "1");
+
+        REQUIRE(Int::lcm("6", "8") == "24");
+        REQUIRE(Int::lcm("24", "48") == "48");
+        REQUIRE(Int::lcm("37", "48") == "1776");
+        REQUIRE(Int::lcm("12345", "54321") == "223530915");
+    }
+
+    SECTION("random")
+    {
+        // static Int random(const Int& a, const Int& b)
+        REQUIRE_THROWS_MATCHES(Int::random(2, 1), std::runtime_error, Message("Error: Require a >= b for random(a, b)."));
+
+        for (int i = 1; i < 10; i++)
+        {
+            REQUIRE(Int::random(1, i).digits() == 1);
+        }
+
+        REQUIRE(Int::random("9999999999999999999999", "9999999999999999999999").digits() == 22);
+
+        Int sum = 0;
+        for (int i = 0; i < 1000; i++) // sum should ~= 0.5 * 1000 = 500
+        {
+            sum += Int::random(0, 1); // mean = 0.5
+        }
+        REQUIRE((int(500 * 0.9) < sum && sum < int(500 * 1.1)));
+
+        // static Int random(int digits)
+        REQUIRE_THROWS_MATCHES(Int::random(0), std::runtime_error, Message("Error: Require digits > 0 for random(digits)."));
+
+        for (int d = 1; d < 10; d++)
+        {
+            REQUIRE(Int::random(d).digits() == d);
+        }
+
+        REQUIRE(Int::random(1024).digits() == 1024);
+
+        sum = 0;
+        for (int i = 0; i < 1000; i++) // sum should ~= 5 * 1000 = 5000
+        {
+            sum += Int::random(1); // mean = 5
+        }
+        REQUIRE((int(5000 * 0.9) < sum && sum < int(5000 * 1.1)));
+    }
+
+    SECTION("fibonacci")
+    {
+        int fib[] = {0, 1, 1, 2, 3, 5, 8, 13, 21, 34};
+
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(Int::fibonacci(i) == fib[i]);
+        }
+
+        REQUIRE(Int::fibonacci(100) == "354224848179261915075");
+    }
+
+    SECTION("ackermann")
+    {
+        // https://en.wikipedia.org/wiki/Ackermann_function#Table_of_values
+        int A[4][10] = {
+            {1, 2, 3, 4, 5, 6, 7, 8, 9, 10},                 // m=0, inc
+            {2, 3, 4, 5, 6, 7, 8, 9, 10, 11},                // m=1, add
+            {3, 5, 7, 9, 11, 13, 15, 17, 19, 21},            // m=2, mul
+            {5, 13, 29, 61, 125, 253, 509, 1021, 2045, 4093} // m=3, pow
+        };
+
+        for (int m = 0; m < 4; m++)
+        {
+            for (int n = 0; n < 10; n++)
+            {
+                REQUIRE(Int::ackermann(m, n) == A[m][n]);
+            }
+        }
+
+        // m=4, tetration
+        REQUIRE(Int::ackermann(4, 0) == 13);             // 2^^3 - 3 = 2^4 - 3     = 13
+        REQUIRE(Int::ackermann(4, 1) == 65533);          // 2^^4 - 3 = 2^16 - 3    = 65533
+        REQUIRE(Int::ackermann(4, 2).digits() == 19729); // 2^^5 - 3 = 2^65536 - 3 = 2003529930406...(19729 digits)
+        // A(4, 3) = 2^^6 - 3 = 2^2^65536 - 3, there is no computer can compute it...
+        REQUIRE_THROWS_MATCHES(Int::ackermann(4, 3), std::runtime_error, Message("Error: The result is too large to compute."));
+
+        // m=5, pentation
+        REQUIRE(Int::ackermann(5, 0) == 65533); // 2^^^3 - 3 = 2^^4 - 3 = 65533
+        REQUIRE_THROWS_MATCHES(Int::ackermann(5, 1), std::runtime_error, Message("Error: The result is too large to compute."));
+        REQUIRE_THROWS_MATCHES(Int::ackermann(6, 0), std::runtime_error, Message("Error: The result is too large to compute."));
+        REQUIRE_THROWS_MATCHES(Int::ackermann(-1, 0), std::runtime_error, Message("Error: Require m >= 0 and n >= 0 for ackermann(m, n)."));
+    }
+
+    SECTION("hyperoperation")
+    {
+        REQUIRE_THROWS_MATCHES(Int::hyperoperation(-1, -1, -1), std::runtime_error, Message("Error: Require n >= 0 and a >= 0 and b >= 0 for hyperoperation(n, a, b)."));
+
+        REQUIRE(Int::hyperoperation(0, 0, 0) == 1);
+        REQUIRE(Int::hyperoperation(1000, 2, 2) == 4);
+
+        REQUIRE(Int::hyperoperation(0, 3, 3) == 4);               // successor
+        REQUIRE(Int::hyperoperation(1, 3, 3) == 6);               // addition
+        REQUIRE(Int::hyperoperation(2, 3, 3) == 9);               // multiplication
+        REQUIRE(Int::hyperoperation(3, 3, 3) == 27);              // exponentiation
+        REQUIRE(Int::hyperoperation(4, 3, 3) == 7625597484987LL); // tetration
+        REQUIRE(Int::hyperoperation(5, 3, 2) == 7625597484987LL); // pentation
+
+        // impossible results fail fast
+        REQUIRE_THROWS_MATCHES(Int::hyperoperation(4, 3, 4), std::runtime_error, Message("Error: The result is too large to compute."));
+        REQUIRE_THROWS_MATCHES(Int::hyperoperation(4, 2, Int::pow(10, 100)), std::runtime_error, Message("Error: The result is too large to compute."));
+        REQUIRE_THROWS_MATCHES(Int::hyperoperation(5, 3, 3), std::runtime_error, Message("Error: The result is too large to compute."));
+        REQUIRE_THROWS_MATCHES(Int::hyperoperation(6, 3, 2), std::runtime_error, Message("Error: The result is too large to compute."));
+        REQUIRE_THROWS_MATCHES(Int::hyperoperation(Int::pow(10, 100), 3, 2), std::runtime_error, Message("Error: The result is too large to compute."));
+    }
+
+    SECTION("constexpr")
+    {
+        static_assert(Int("18446744073709551617") + Int("-18446744073709551617") == 0);
+        static_assert(Int("123456789012345678901234567890") * -987654321 == Int("-121932631124828532112482853211126352690"));
+        static_assert(Int::pow(2, 100) == Int("1267650600228229401496703205376"));
+        static_assert(Int::pow(3, 1000, 1'000'000'007) == 56888193);
+        static_assert(Int::pow(10, 500) / Int::pow(10, 400) == Int::pow(10, 100));
+        static_assert(Int(30).factorial().digits() == 33);
+        static_assert(Int::gcd(Int::pow(2, 100), Int::pow(6, 50)) == Int::pow(2, 50));
+        static_assert(Int(std::numeric_limits<long long>::min()) == Int("-9223372036854775808"));
+        static_assert([]()
+                      {
+                          char buffer[32]{};
+                          auto [ptr, ec] = Int("-18446744073709551617").to_chars(buffer, buffer + 32);
+                          return std::string_view(buffer, ptr) == "-18446744073709551617"; }());
+
+        // constant initialization, allocate at run time
+        static constinit Int constant;
+        constant = Int::pow(2, 100);
+        REQUIRE(constant == Int("1267650600228229401496703205376"));
+    }
+
+    SECTION("memory")
+    {
+        const Int expected = Int(300).factorial();
+
+        // arena and pool
+        Int result;
+        {
+            Int::Arena arena;
+            result = Int(300).factorial();
+            {
+                Int::Pool pool;
+                REQUIRE(Int(300).factorial() == expected);
+            }
+            REQUIRE(Int(300).factorial() == expected);
+        }
+        REQUIRE(result == expected);
+
+        // custom resource
+        char buffer[1024];
+        std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+        {
+            Int::Scope scope(&resource);
+            REQUIRE(Int(123456789) * Int(987654321) == "121932631112635269");
+            REQUIRE_THROWS_AS(Int::random(100000), std::bad_alloc);
+            result = Int(123456789);
+        }
+        REQUIRE(result == 123456789);
+        REQUIRE(Int::random(100000).digits() == 100000);
+    }
+
+    SECTION("hash")
+    {
+        std::hash<Int> hash;
+        REQUIRE(hash(Int("18446744073709551617")) == hash(Int(1) + Int("18446744073709551616")));
+        REQUIRE(hash(Int(1)) != hash(Int(-1)));
+        REQUIRE(hash(Int("1000000002")) != hash(Int("2000000001"))); // same chunks in different order
+
+        // no collision among nearby and structured values
+        std::vector<std::size_t> hashes;
+        for (int i = 0; i < 10000; ++i)
+        {
+            hashes.push_back(hash(i));
+            hashes.push_back(hash(Int::pow(10, 9) * i));
+            hashes.push_back(hash(Int::pow(2, i)));
+        }
+        std::sort(hashes.begin(), hashes.end());
+        REQUIRE(std::unique(hashes.begin(), hashes.end()) - hashes.begin() == 29985); // 0 and 2^0 to 2^13 are repeated
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+
+        oss << zero;
+        REQUIRE(oss.str() == "0");
+        oss.str("");
+
+        oss << positive;
+        REQUIRE(oss.str() == "18446744073709551617");
+        oss.str("");
+
+        oss << negative;
+        REQUIRE(oss.str() == "-18446744073709551617");
+        oss.str("");
+
+        oss << Int("1000000000000000000000000001");
+        REQUIRE(oss.str() == "1000000000000000000000000001");
+        oss.str("");
+    }
+
+    SECTION("double")
+    {
+        // to_double()
+        REQUIRE(zero.to_double() == 0.0);
+        REQUIRE(positive.to_double() == 18446744073709551617.0);
+        REQUIRE(negative.to_number<double>() == -18446744073709551617.0);
+        REQUIRE(Int("9007199254740993").to_double() == 9007199254740992.0); // ties to even
+        REQUIRE(Int("9007199254740995").to_double() == 9007199254740996.0);
+        REQUIRE((Int::pow(2, 200) + Int::pow(2, 147)).to_double() == 0x1p200);                   // tie, exact rounding
+        REQUIRE((Int::pow(2, 200) + Int::pow(2, 147) + 1).to_double() == 0x1.0000000000001p200); // above tie by 1
+        REQUIRE((Int::pow(2, 1024) - Int::pow(2, 970) - 1).to_double() == 0x1.fffffffffffffp1023);
+        REQUIRE_THROWS_MATCHES((Int::pow(2, 1024) - Int::pow(2, 970)).to_double(), std::runtime_error, Message("Error: Integer too large to convert to double."));
+        REQUIRE_THROWS_MATCHES(Int::pow(10, 400).to_double(), std::runtime_error, Message("Error: Integer too large to convert to double."));
+
+        // Int(double number)
+        REQUIRE(Int(0.0) == 0);
+        REQUIRE(Int(-0.9) == 0);
+        REQUIRE(Int(123.9) == 123);
+        REQUIRE(Int(-9007199254740992.0) == Int("-9007199254740992"));
+        REQUIRE(Int(1e300) == Int("1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160"));
+        REQUIRE(Int(-std::pow(2.5, 100)) == Int("-6223015277861141806107998391978220847104"));
+        REQUIRE(Int(0x1.fffffffffffffp1023).to_double() == 0x1.fffffffffffffp1023);
+        REQUIRE_THROWS_MATCHES(Int(std::nan("")), std::runtime_error, Message("Error: Cannot convert NaN or infinity to integer."));
+        REQUIRE_THROWS_MATCHES(Int(-INFINITY), std::runtime_error, Message("Error: Cannot convert NaN or infinity to integer."));
+    }
+
+    SECTION("to_chars")
+    {
+        char buffer[32];
+
+        auto [ptr1, ec1] = zero.to_chars(buffer, buffer + 1);
+        REQUIRE(ec1 == std::errc());
+        REQUIRE(std::string_view(buffer, ptr1) == "0");
+
+        auto [ptr2, ec2] = negative.to_chars(buffer, buffer + 21);
+        REQUIRE(ec2 == std::errc());
+        REQUIRE(std::string_view(buffer, ptr2) == "-18446744073709551617");
+
+        auto [ptr3, ec3] = negative.to_chars(buffer, buffer + 20);
+        REQUIRE(ec3 == std::errc::value_too_large);
+        REQUIRE(ptr3 == buffer + 20);
+
+        for (int d = 1; d < 100; ++d)
+        {
+            Int n = Int::random(d);
+            std::string str(d, '\0');
+            REQUIRE(n.to_chars(str.data(), str.data() + d).ptr == str.data() + d);
+            REQUIRE(Int(str.c_str()) == n);
+
+            std::ostringstream oss;
+            oss << n;
+            REQUIRE(oss.str() == str);
+        }
+
+#ifdef __cpp_lib_format
+        REQUIRE(std::format("{}", zero) == "0");
+        REQUIRE(std::format("{}", positive) == "18446744073709551617");
+        REQUIRE(std::format("[{}]", negative) == "[-18446744073709551617]");
+#endif
+    }
+
+    SECTION("to_string")
+    {
+        REQUIRE(zero.to_string() == "0");
+        REQUIRE(zero.to_string(2) == "0");
+        REQUIRE(positive.to_string() == "18446744073709551617");
+        REQUIRE(negative.to_string() == "-18446744073709551617");
+        REQUIRE(positive.to_string(16) == "10000000000000001");
+        REQUIRE(Int("-18446744073709551615").to_string(16) == "-ffffffffffffffff");
+        REQUIRE(Int(5).to_string(2) == "101");
+        REQUIRE(Int(-8).to_string(8) == "-10");
+        REQUIRE(Int(35).to_string(36) == "z");
+        REQUIRE_THROWS_MATCHES(positive.to_string(1), std::runtime_error, Message("Error: Invalid base for to_string()."));
+        REQUIRE_THROWS_MATCHES(positive.to_string(37), std::runtime_error, Message("Error: Invalid base for to_string()."));
+
+        // divide and conquer conversion
+        REQUIRE(Int::pow(16, 3000).to_string(16) == "1" + std::string(3000, '0'));
+        REQUIRE((Int::pow(2, 5000) - 1).to_string(2) == std::string(5000, '1'));
+        for (int base : {2, 3, 16, 36})
+        {
+            Int n = -Int::random(3000);
+            std::string str = n.to_string(base);
+            Int m;
+            Int::from_chars(str.data(), str.data() + str.size(), m, base);
+            REQUIRE(m == n);
+        }
+
+#ifdef __cpp_lib_format
+        REQUIRE(std::format("{:d}", negative) == "-18446744073709551617");
+        REQUIRE(std::format("{:x}", Int(255)) == "ff");
+        REQUIRE(std::format("{:X}", Int(-255)) == "-FF");
+        REQUIRE(std::format("{:b}", Int(5)) == "101");
+        REQUIRE(std::format("{:o}", Int(8)) == "10");
+#endif
+    }
+
+    SECTION("from_chars")
+    {
+        auto parse = [](std::string_view str, int base = 10)
+        {
+            Int n = 233;
+            auto [ptr, ec] = Int::from_chars(str.data(), str.data() + str.size(), n, base);
+            return std::tuple{n, ptr - str.data(), ec};
+        };
+
+        REQUIRE(parse("0") == std::tuple{0, 1, std::errc()});
+        REQUIRE(parse("-0") == std::tuple{0, 2, std::errc()});
+        REQUIRE(parse("000123456789000") == std::tuple{123456789000, 15, std::errc()});
+        REQUIRE(parse("-18446744073709551617!") == std::tuple{"-18446744073709551617", 21, std::errc()});
+        REQUIRE(parse("") == std::tuple{233, 0, std::errc::invalid_argument});
+        REQUIRE(parse("-") == std::tuple{233, 0, std::errc::invalid_argument});
+        REQUIRE(parse("+1") == std::tuple{233, 0, std::errc::invalid_argument});
+        REQUIRE(parse("a") == std::tuple{233, 0, std::errc::invalid_argument});
+
+        REQUIRE(parse("101", 2) == std::tuple{5, 3, std::errc()});
+        REQUIRE(parse("1012", 2) == std::tuple{5, 3, std::errc()});
+        REQUIRE(parse("-ffffffffffffffff", 16) == std::tuple{"-18446744073709551615", 17, std::errc()});
+        REQUIRE(parse("CafeBabe", 16) == std::tuple{3405691582, 8, std::errc()});
+        REQUIRE(parse("zZ", 36) == std::tuple{1295, 2, std::errc()});
+        REQUIRE_THROWS_MATCHES(parse("1", 1), std::runtime_error, Message("Error: Invalid base for from_chars()."));
+        REQUIRE_THROWS_MATCHES(parse("1", 37), std::runtime_error, Message("Error: Invalid base for from_chars()."));
+
+        // divide and conquer conversion
+        for (int base : {2, 7, 16, 36})
+        {
+            std::string str;
+            Int expected;
+            for (int i = 0; i < 3000; ++i)
+            {
+                int d = Int::random(0, base - 1).to_number();
+                str += "0123456789abcdefghijklmnopqrstuvwxyz"[d];
+                expected = expected * base + d;
+            }
+            REQUIRE(std::get<0>(parse(str, base)) == expected);
+        }
+    }
+
+    SECTION("bytes")
+    {
+        using Bytes = std::vector<unsigned char>;
+
+        REQUIRE(Int(0).to_bytes(0) == Bytes{});
+        REQUIRE(Int(1024).to_bytes(2) == Bytes{0x04, 0x00});
+        REQUIRE(Int(1024).to_bytes(3, std::endian::little) == Bytes{0x00, 0x04, 0x00});
+        REQUIRE(Int(255).to_bytes(1) == Bytes{0xff});
+        REQUIRE(Int(-1).to_bytes(2, std::endian::big, true) == Bytes{0xff, 0xff});
+        REQUIRE(Int(-128).to_bytes(1, std::endian::big, true) == Bytes{0x80});
+        REQUIRE(Int(-1024).to_bytes(4, std::endian::little, true) == Bytes{0x00, 0xfc, 0xff, 0xff});
+        REQUIRE_THROWS_MATCHES(Int(256).to_bytes(1), std::runtime_error, Message("Error: Integer too big to convert."));
+        REQUIRE_THROWS_MATCHES(Int(128).to_bytes(1, std::endian::big, true), std::runtime_error, Message("Error: Integer too big to convert."));
+        REQUIRE_THROWS_MATCHES(Int(-129).to_bytes(1, std::endian::big, true), std::runtime_error, Message("Error: Integer too big to convert."));
+        REQUIRE_THROWS_MATCHES(Int(-1).to_bytes(1), std::runtime_error, Message("Error: Can't convert negative integer to unsigned."));
+
+        REQUIRE(Int::from_bytes({}) == 0);
+        REQUIRE(Int::from_bytes({0x04, 0x00}) == 1024);
+        REQUIRE(Int::from_bytes({0xff}) == 255);
+        REQUIRE(Int::from_bytes({0xff}, std::endian::big, true) == -1);
+        REQUIRE(Int::from_bytes({0x00, 0xfc, 0xff, 0xff}, std::endian::little, true) == -1024);
+
+        Int big = Int::pow(-123456789, 100);
+        for (bool is_signed : {false, true})
+        {
+            for (auto order : {std::endian::big, std::endian::little})
+            {
+                REQUIRE(Int::from_bytes(big.to_bytes(400, order, is_signed), order, is_signed) == big);
+                REQUIRE(Int::from_bytes((-big).to_bytes(400, order, true), order, true) == -big);
+            }
+        }
+    }
+
+    SECTION("dump_load")
+    {
+        std::stringstream ss;
+        Int(0).dump(ss);
+        Int("-123456789012345678901234567890").dump(ss);
+        Int(233).dump(ss);
+
+        REQUIRE(Int::load(ss) == 0);
+        REQUIRE(Int::load(ss) == Int("-123456789012345678901234567890"));
+        REQUIRE(Int::load(ss) == 233);
+        REQUIRE_THROWS_MATCHES(Int::load(ss), std::runtime_error, Message("Error: Invalid raw integer data."));
+
+        // load from memory
+        std::string data = ss.str();
+        Int n;
+        const char* ptr = Int::load(data.data(), data.data() + data.size(), n);
+        REQUIRE(n == 0);
+        ptr = Int::load(ptr, data.data() + data.size(), n);
+        REQUIRE(n == Int("-123456789012345678901234567890"));
+        ptr = Int::load(ptr, data.data() + data.size(), n);
+        REQUIRE(n == 233);
+        REQUIRE(ptr == data.data() + data.size());
+        REQUIRE_THROWS_MATCHES(Int::load(data.data() + 9, data.data() + 20, n), std::runtime_error, Message("Error: Invalid raw integer data."));
+
+        data[0] = 2;
+        REQUIRE_THROWS_MATCHES(Int::load(data.data(), data.data() + data.size(), n), std::runtime_error, Message("Error: Invalid raw integer data."));
+    }
+
+    SECTION("input")
+    {
+        Int int1, int2, int3, int4;
+        std::istringstream("+123\n-456\t789 0") >> int1 >> int2 >> int3 >> int4;
+
+        REQUIRE(int1 == Int("123"));
+        REQUIRE(int2 == Int("-456"));
+        REQUIRE(int3 == Int("789"));
+        REQUIRE(int4 == Int("0"));
+    }
+}
@@ -0,0 +1,100 @@
+#include "../sources/mod_int.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("ModInt")
+{
+    ModContext prime("1000000007");         // Montgomery form
+    ModContext even("1000000000000000000"); // plain form
+    ModContext big(Int::pow(2, 521) - 1);   // Mersenne prime, Montgomery form
+
+    SECTION("basics")
+    {
+        REQUIRE(prime.mod() == 1000000007);
+        REQUIRE(prime.is_montgomery());
+        REQUIRE(!even.is_montgomery());
+        REQUIRE(big.is_montgomery());
+        REQUIRE_THROWS_MATCHES(ModContext(0), std::runtime_error, Message("Error: Require mod > 0 for ModContext(mod)."));
+
+        REQUIRE(ModInt(prime).value() == 0);
+        REQUIRE(ModInt(prime, 1000000008).value() == 1);
+        REQUIRE(ModInt(prime, -1).value() == 1000000006);
+        REQUIRE(ModInt(even, "-1").value() == Int("999999999999999999"));
+        REQUIRE(ModInt(ModContext(1), 5).value() == 0);
+    }
+
+    SECTION("compare")
+    {
+        REQUIRE(ModInt(prime, 1) == ModInt(prime, 1000000008));
+        REQUIRE(ModInt(prime, 1) != ModInt(prime, 2));
+        REQUIRE(ModInt(prime, 1) == ModInt(ModContext(1000000007), 1)); // same modulus
+        REQUIRE_THROWS_MATCHES(ModInt(prime, 1) == ModInt(even, 1), std::runtime_error, Message("Error: The modulus of two values are different."));
+    }
+
+    SECTION("arithmetic")
+    {
+        for (const ModContext* context : {&prime, &even, &big})
+        {
+            const Int& mod = context->mod();
+            for (int i = 0; i < 100; ++i)
+            {
+                Int a = Int::random(mod.digits()) % mod, b = Int::random(mod.digits()) % mod;
+                ModInt x(*context, a), y(*context, b);
+
+                REQUIRE((x + y).value() == (a + b) % mod);
+                REQUIRE((x - y).value() == (a - b + mod) % mod);
+                REQUIRE((x * y).value() == a * b % mod);
+                REQUIRE((-x).value() == (mod - a) % mod);
+                REQUIRE(x.pow(12345).value() == Int::pow(a, 12345, mod));
+            }
+        }
+
+        ModInt x(big, Int::pow(3, 500));
+        REQUIRE(x / x == ModInt(big, 1));
+        REQUIRE(x * x.inverse() == ModInt(big, 1));
+        REQUIRE(x.pow(-2) * x.pow(2) == ModInt(big, 1));
+        REQUIRE(ModInt(prime, 2).pow(1000000006) == ModInt(prime, 1)); // Fermat's little theorem
+        REQUIRE(ModInt(even, 3).inverse() * ModInt(even, 3) == ModInt(even, 1));
+        REQUIRE_THROWS_MATCHES(ModInt(even, 2).inverse(), std::runtime_error, Message("Error: The value is not invertible."));
+        REQUIRE_THROWS_MATCHES(ModInt(prime, 1) / ModInt(prime, 0), std::runtime_error, Message("Error: The value is not invertible."));
+    }
+
+    SECTION("batch_inverse")
+    {
+        List<ModInt> values;
+        for (int i = 1; i <= 100; ++i)
+        {
+            values += ModInt(big, Int::pow(i, 100));
+        }
+
+        List<ModInt> inverses = big.batch_inverse(values);
+        REQUIRE(inverses.size() == 100);
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(inverses[i] == values[i].inverse());
+        }
+
+        REQUIRE(big.batch_inverse({}).size() == 0);
+        REQUIRE_THROWS_MATCHES(even.batch_inverse({ModInt(even, 3), ModInt(even, 4)}), std::runtime_error, Message("Error: The value is not invertible."));
+    }
+
+    SECTION("crt")
+    {
+        REQUIRE(ModContext::crt({2, 3, 2}, {3, 5, 7}) == 23);
+        REQUIRE(ModContext::crt({}, {}) == 0);
+        REQUIRE(ModContext::crt({3, 5}, {4, 6}) == 11); // not coprime
+        REQUIRE(ModContext::crt({-1, -1}, {Int::pow(10, 20), Int::pow(3, 40)}) == Int::pow(10, 20) * Int::pow(3, 40) - 1);
+        REQUIRE_THROWS_MATCHES(ModContext::crt({1, 2}, {4, 6}), std::runtime_error, Message("Error: No solution for crt(remainders, moduli)."));
+        REQUIRE_THROWS_MATCHES(ModContext::crt({1}, {0}), std::runtime_error, Message("Error: Require moduli > 0 for crt(remainders, moduli)."));
+        REQUIRE_THROWS_MATCHES(ModContext::crt({1}, {}), std::runtime_error, Message("Error: Require remainders.size() == moduli.size() for crt(remainders, moduli)."));
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+        oss << ModInt(prime, -1) << ' ' << ModInt(big, 10);
+        REQUIRE(oss.str() == "1000000006 10");
+    }
+}
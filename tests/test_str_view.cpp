@@ -0,0 +1,167 @@
+#include "../sources/str_view.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("StrView")
+{
+    SECTION("basics")
+    {
+        // StrView()
+        StrView v1;
+        REQUIRE(v1.size() == 0);
+        REQUIRE(v1.is_empty());
+
+        // StrView(const char* chars)
+        const char* chars = "hello";
+        StrView v2(chars);
+        REQUIRE(v2.size() == 5);
+        REQUIRE(v2.data() == chars);
+
+        // StrView(const char* data, int size)
+        StrView v3(chars + 1, 3);
+        REQUIRE(v3 == "ell");
+
+        // StrView(const std::string& string)
+        std::string string = "world";
+        StrView v4(string);
+        REQUIRE(v4.data() == string.data());
+    }
+
+    StrView empty;
+    StrView view = "one, two, three";
+
+    SECTION("compare")
+    {
+        REQUIRE(empty == "");
+        REQUIRE(view == "one, two, three");
+        REQUIRE(view != "one");
+        REQUIRE(StrView("abc") < StrView("abd"));
+        REQUIRE(StrView("abc") > StrView("ab"));
+    }
+
+    SECTION("iterator")
+    {
+        REQUIRE(std::string(view.begin(), view.end()) == "one, two, three");
+        REQUIRE(std::string(view.rbegin(), view.rend()) == "eerht ,owt ,eno");
+    }
+
+    SECTION("access")
+    {
+        REQUIRE(view[0] == 'o');
+        REQUIRE(view[-1] == 'e');
+        REQUIRE_THROWS_MATCHES(view[15], std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("examination")
+    {
+        REQUIRE(view.find("two") == 5);
+        REQUIRE(view.find("two", 6) == -1);
+        REQUIRE(view.find("o", 1, 7) == -1);
+        REQUIRE(view.find("o", 1, 8) == 7);
+        REQUIRE(view.contains(", t"));
+        REQUIRE(view.count(", ") == 2);
+        REQUIRE(view.count("") == 16);
+        REQUIRE(view.starts_with("one"));
+        REQUIRE(view.ends_with("three"));
+        REQUIRE(!view.ends_with("two"));
+
+        REQUIRE(StrView("233.33").to_decimal() == 233.33);
+        REQUIRE(StrView("-1e3").to_decimal() == -1000);
+        REQUIRE_THROWS_MATCHES(StrView("1e").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+
+        REQUIRE(StrView(" -233 ").to_integer() == -233);
+        REQUIRE(StrView("cafebabe").to_integer(16) == 3405691582);
+        REQUIRE_THROWS_MATCHES(StrView("12a").to_integer(), std::runtime_error, Message("Error: Invalid literal for to_integer()."));
+
+        // a view in the middle of a buffer stops at its own end
+        StrView number = StrView("12345").slice(1, 3);
+        REQUIRE(number.to_integer() == 23);
+        REQUIRE(number.to_decimal() == 23);
+    }
+
+    SECTION("production")
+    {
+        StrView slice = view.slice(5, 8);
+        REQUIRE(slice == "two");
+        REQUIRE(slice.data() == view.data() + 5);
+        REQUIRE(view.slice(-5, -1) == "thre");
+        REQUIRE(view.slice(3, 3) == empty);
+        REQUIRE_THROWS_MATCHES(view.slice(15, 15), std::runtime_error, Message("Error: Index out of range."));
+
+        StrView stripped = StrView("  hi  ").strip();
+        REQUIRE(stripped == "hi");
+        REQUIRE(StrView("--a--").strip('-') == "a");
+        REQUIRE(StrView("    ").strip() == empty);
+
+        List<StrView> parts = view.split(", ");
+        REQUIRE(parts == List<StrView>({"one", "two", "three"}));
+        REQUIRE(parts[2].data() == view.data() + 10);
+        REQUIRE(StrView("   1   2   3   ").split() == List<StrView>({"1", "2", "3"}));
+        REQUIRE(StrView("aaa").split("a") == List<StrView>());
+        REQUIRE(StrView("aaa").split("a", true) == List<StrView>({"", "", "", ""}));
+        REQUIRE_THROWS_MATCHES(view.split(""), std::runtime_error, Message("Error: Empty separator."));
+    }
+
+    SECTION("split_iter")
+    {
+        static_assert(std::ranges::forward_range<StrView::SplitRange>);
+        static_assert(std::ranges::view<StrView::SplitRange>);
+
+        auto collect = [](auto&& range)
+        {
+            List<StrView> list;
+            for (const auto& part : range)
+            {
+                list += part;
+            }
+            return list;
+        };
+
+        // same parts as split()
+        for (StrView str : {"one, two, three", "", ", ", "a, , b, ", "   1   2   3   "})
+        {
+            for (StrView sep : {", ", " "})
+            {
+                REQUIRE(collect(str.split_iter(sep)) == str.split(sep));
+                REQUIRE(collect(str.split_iter(sep, true)) == str.split(sep, true));
+            }
+        }
+
+        // maxsplit
+        REQUIRE(collect(view.split_iter(", ", false, 1)) == List<StrView>({"one", "two, three"}));
+        REQUIRE(collect(view.split_iter(", ", false, 0)) == List<StrView>({"one, two, three"}));
+        REQUIRE(collect(view.split_iter(", ", false, 5)) == List<StrView>({"one", "two", "three"}));
+        REQUIRE(collect(StrView("  a   b  c  ").split_iter(" ", false, 1)) == List<StrView>({"a", "b  c  "}));
+        REQUIRE(collect(StrView("a,,b,c").split_iter(",", true, 2)) == List<StrView>({"a", "", "b,c"}));
+
+        // lazy and composable
+        auto parts = view.split_iter(", ");
+        auto it = parts.begin();
+        REQUIRE(*it == "one");
+        REQUIRE((*it).data() == view.data());
+        REQUIRE(*++it == "two");
+        REQUIRE(collect(parts | std::views::take(2)) == List<StrView>({"one", "two"}));
+        REQUIRE(collect(parts | std::views::filter([](StrView s) { return s.starts_with("t"); })) == List<StrView>({"two", "three"}));
+        REQUIRE(std::ranges::distance(parts) == 3);
+        REQUIRE(*std::ranges::find(view.split_iter(", "), StrView("three")) == "three");
+
+        REQUIRE(std::ranges::empty(StrView::SplitRange()));
+        REQUIRE_THROWS_MATCHES(view.split_iter(""), std::runtime_error, Message("Error: Empty separator."));
+    }
+
+    SECTION("hash")
+    {
+        std::hash<StrView> hash;
+        REQUIRE(hash(view.slice(0, 3)) == hash(StrView("one")));
+        REQUIRE(hash(view.slice(0, 3)) != hash(view.slice(5, 8)));
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+        oss << empty << ' ' << view.slice(0, 3);
+        REQUIRE(oss.str() == "\"\" \"one\"");
+    }
+}